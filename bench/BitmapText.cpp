@@ -0,0 +1,76 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/bench_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <string>
+
+// Measures `BitmapText` geometry rebuilds of a 10k character string, both
+// when only a layout property changes and when the string is replaced.
+
+namespace
+{
+    constexpr std::size_t chars{10000};
+    constexpr std::size_t lineLength{80};
+    constexpr std::size_t rebuilds{200};
+    constexpr std::size_t reps{5};
+
+    std::string mkText(char mFirst)
+    {
+        std::string result;
+        result.reserve(chars);
+
+        for(std::size_t i{0}; i < chars; ++i)
+            result += (i % lineLength == lineLength - 1)
+                          ? '\n'
+                          : char(mFirst + char(i % 64));
+
+        return result;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace ssvs;
+
+    bench_init(argc, argv);
+
+    // The texture is never drawn, so it does not need to be created.
+    const sf::Texture texture;
+    const BitmapFont font{texture, {32, 8, 10, 0}};
+
+    const auto strA(mkText('!')), strB(mkText('#'));
+    BitmapText text{font, strA};
+
+    bench_run("BitmapText rebuild (tracking)", reps, rebuilds * chars, [&] {
+        float sum{0.f};
+        for(std::size_t i{0}; i < rebuilds; ++i)
+        {
+            text.setTracking(float(i % 2));
+            sum += text.getLocalBounds().width;
+        }
+        impl::do_not_optimize(sum);
+    });
+
+    bench_run("BitmapText rebuild (setString)", reps, rebuilds * chars, [&] {
+        float sum{0.f};
+        for(std::size_t i{0}; i < rebuilds; ++i)
+        {
+            text.setString(i % 2 == 0 ? strA : strB);
+            sum += text.getLocalBounds().width;
+        }
+        impl::do_not_optimize(sum);
+    });
+
+    bench_run("BitmapText rebuild (align)", reps, rebuilds * chars, [&] {
+        float sum{0.f};
+        for(std::size_t i{0}; i < rebuilds; ++i)
+        {
+            text.setAlign(i % 2 == 0 ? TextAlign::Left : TextAlign::Center);
+            sum += text.getLocalBounds().width;
+        }
+        impl::do_not_optimize(sum);
+    });
+}
@@ -0,0 +1,76 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/bench_utils.hpp"
+#include "./utils/null_render_target.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+// Measures `BitmapTextRich` with nested chunks animated by wave effects:
+// full rebuilds of the chunk hierarchy, and the per-frame effect refresh
+// that happens when an animated text is drawn.
+
+namespace
+{
+    constexpr std::size_t lines{100};
+    constexpr std::size_t charsPerLine{18 + 22 + 16};
+    constexpr std::size_t chars{lines * charsPerLine};
+    constexpr std::size_t frames{500};
+    constexpr std::size_t rebuilds{100};
+    constexpr std::size_t reps{5};
+
+    // Each line holds `charsPerLine` characters in three levels of chunks,
+    // two of which are animated by their own wave.
+    void build(ssvs::BitmapTextRich& mText)
+    {
+        using namespace ssvs;
+
+        for(std::size_t i{0}; i < lines; ++i)
+        {
+            auto& outer(mText.in());
+            outer.eff<BTR::Wave>(2.f, 0.1f);
+            outer.in("Lorem ipsum dolor ");
+
+            auto& inner(outer.in());
+            inner.eff<BTR::Wave>(4.f, 0.2f);
+            inner.in("sit amet, consectetur ");
+            inner.in().in("adipiscing elit\n");
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace ssvs;
+
+    bench_init(argc, argv);
+
+    // The texture is never drawn, so it does not need to be created.
+    const sf::Texture texture;
+    const BitmapFont font{texture, {32, 8, 10, 0}};
+
+    BitmapTextRich text{font};
+    build(text);
+
+    bench_run("BTRRoot rebuild", reps, rebuilds * chars, [&] {
+        float sum{0.f};
+        for(std::size_t i{0}; i < rebuilds; ++i)
+        {
+            text.clear();
+            build(text);
+            sum += text.getGlobalBounds().height;
+        }
+        impl::do_not_optimize(sum);
+    });
+
+    null_render_target target;
+
+    bench_run("BTRRoot update + refresh (waves)", reps, frames * chars, [&] {
+        for(std::size_t i{0}; i < frames; ++i)
+        {
+            text.update(1.f);
+            target.draw(text);
+        }
+        impl::do_not_optimize(text.getGlobalBounds());
+    });
+}
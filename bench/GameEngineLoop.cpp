@@ -0,0 +1,61 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/bench_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+// Measures the per-tick overhead of the engine loop with a runtime-swappable
+// `GameTimer` versus a `TimerStatic` policy known at compile time.
+
+namespace
+{
+    constexpr std::size_t frames{1000000};
+    constexpr std::size_t ticksPerFrame{4};
+    constexpr std::size_t reps{5};
+
+    template <typename THeadless>
+    void runLoop(THeadless& mHeadless)
+    {
+        ssvs::GameState state;
+        std::size_t sum{0};
+
+        state.onUpdate += [&sum](ssvs::FT) { ++sum; };
+        mHeadless.setGameState(state);
+        mHeadless.run(frames);
+
+        impl::do_not_optimize(sum);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace ssvs;
+
+    bench_init(argc, argv);
+
+    bench_run("GameTimer (TimerStatic)", reps, frames * ticksPerFrame, [] {
+        GameHeadless headless;
+        headless.setTimer<TimerStatic>(1.f, 1.f);
+        headless.setFrameTime(FT(ticksPerFrame));
+        runLoop(headless);
+    });
+
+    bench_run("BasicGameHeadless<TimerStatic>", reps, frames * ticksPerFrame,
+        [] {
+            BasicGameHeadless<TimerStatic> headless;
+            headless.setFrameTime(FT(ticksPerFrame));
+            runLoop(headless);
+        });
+
+    bench_run("GameTimer (TimerDynamic)", reps, frames, [] {
+        GameHeadless headless;
+        headless.setTimer<TimerDynamic>();
+        runLoop(headless);
+    });
+
+    bench_run("BasicGameHeadless<TimerDynamic>", reps, frames, [] {
+        BasicGameHeadless<TimerDynamic> headless;
+        runLoop(headless);
+    });
+}
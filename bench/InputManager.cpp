@@ -0,0 +1,72 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/bench_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+// Measures a full input pass (`refresh` followed by `update`) of an
+// `Input::Manager` holding hundreds of binds, with a few keys held down.
+
+namespace
+{
+    constexpr std::size_t frames{20000};
+    constexpr std::size_t reps{5};
+
+    void addBinds(ssvs::Input::Manager& mManager, std::size_t mCount,
+        std::size_t& mFired)
+    {
+        using namespace ssvs;
+        using namespace ssvs::Input;
+
+        for(std::size_t i{0}; i < mCount; ++i)
+        {
+            // Mix single keys, two-key combos and alternative combos, like
+            // the bindings of a real game.
+            Combo c0, c1;
+            c0.addKey(KKey(i % kKeyCount));
+            if(i % 3 == 0) c0.addKey(KKey((i * 7 + 1) % kKeyCount));
+            if(i % 4 == 0) c1.addBtn(MBtn(i % mBtnCount));
+
+            Trigger t{c0};
+            if(i % 4 == 0) t.getCombos().emplace_back(c1);
+
+            mManager.emplace(t, i % 2 == 0 ? Type::Always : Type::Once,
+                Mode::Overlap, -1, [&mFired](FT) { ++mFired; });
+        }
+    }
+
+    void run(std::size_t mBindCount)
+    {
+        using namespace ssvs;
+
+        Input::Manager manager;
+        Input::InputState state;
+        std::size_t fired{0};
+
+        addBinds(manager, mBindCount, fired);
+
+        state[KKey::A] = true;
+        state[KKey::LShift] = true;
+        state[MBtn::Left] = true;
+
+        for(std::size_t i{0}; i < frames; ++i)
+        {
+            manager.refresh(state);
+            manager.update(state, 1.f);
+        }
+
+        impl::do_not_optimize(fired);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bench_init(argc, argv);
+
+    for(const std::size_t binds : {100, 300, 1000})
+    {
+        const auto name("Input::Manager " + std::to_string(binds) + " binds");
+        bench_run(name.c_str(), reps, frames * binds, [binds] { run(binds); });
+    }
+}
@@ -0,0 +1,81 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/bench_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Measures `ResourceHolder` lookups by id, which is how game code reaches
+// its assets every frame. `Tileset` is used as the resource type since it
+// can be loaded without a GL context.
+
+namespace
+{
+    constexpr std::size_t resourceCount{512};
+    constexpr std::size_t lookups{1000000};
+    constexpr std::size_t reps{5};
+
+    using Holder = ssvs::Impl::ResourceHolder<ssvs::Tileset,
+        ssvs::RHPolicyDefault>;
+}
+
+int main(int argc, char** argv)
+{
+    using namespace ssvs;
+
+    bench_init(argc, argv);
+
+    Holder holder;
+    std::vector<std::string> ids;
+    std::vector<AssetHandle<Tileset>> handles;
+
+    for(unsigned int i{0}; i < resourceCount; ++i)
+    {
+        ids.emplace_back("Sprites/Characters/sheet" + std::to_string(i));
+        holder.load(ids.back(), Tileset{{i + 1, i + 1}});
+        handles.emplace_back(holder.getHandle(ids.back()));
+    }
+
+    bench_run("ResourceHolder operator[]", reps, lookups, [&] {
+        unsigned int sum{0};
+        for(std::size_t i{0}; i < lookups; ++i)
+            sum += holder[ids[i % resourceCount]].getTileSize().x;
+        impl::do_not_optimize(sum);
+    });
+
+    bench_run("ResourceHolder operator[] literal", reps, lookups, [&] {
+        unsigned int sum{0};
+        for(std::size_t i{0}; i < lookups; ++i)
+            sum += holder["Sprites/Characters/sheet42"].getTileSize().x;
+        impl::do_not_optimize(sum);
+    });
+
+    bench_run("ResourceHolder operator[] const view", reps, lookups, [&] {
+        const auto& cHolder(holder);
+        unsigned int sum{0};
+        for(std::size_t i{0}; i < lookups; ++i)
+        {
+            const std::string_view id{ids[i % resourceCount]};
+            sum += cHolder[id].getTileSize().x;
+        }
+        impl::do_not_optimize(sum);
+    });
+
+    bench_run("ResourceHolder operator[] handle", reps, lookups, [&] {
+        unsigned int sum{0};
+        for(std::size_t i{0}; i < lookups; ++i)
+            sum += holder[handles[i % resourceCount]].getTileSize().x;
+        impl::do_not_optimize(sum);
+    });
+
+    bench_run("ResourceHolder has", reps, lookups, [&] {
+        std::size_t found{0};
+        for(std::size_t i{0}; i < lookups; ++i)
+            found += holder.has(ids[i % resourceCount]);
+        impl::do_not_optimize(found);
+    });
+}
@@ -0,0 +1,56 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/bench_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <string>
+#include <vector>
+
+// Measures `Tileset` rectangle lookups by label, which hash the label on
+// every call, against lookups by index.
+
+namespace
+{
+    constexpr std::size_t labelCount{256};
+    constexpr std::size_t lookups{1000000};
+    constexpr std::size_t reps{5};
+}
+
+int main(int argc, char** argv)
+{
+    using namespace ssvs;
+
+    bench_init(argc, argv);
+
+    Tileset tileset{{16, 16}};
+    std::vector<std::string> labels;
+
+    for(unsigned int i{0}; i < labelCount; ++i)
+    {
+        labels.emplace_back("tile_label_" + std::to_string(i));
+        tileset.setLabel(labels.back(), {i % 16, i / 16});
+    }
+
+    bench_run("Tileset label lookup", reps, lookups, [&] {
+        int sum{0};
+        for(std::size_t i{0}; i < lookups; ++i)
+            sum += tileset(labels[i % labelCount]).left;
+        impl::do_not_optimize(sum);
+    });
+
+    bench_run("Tileset label lookup (literal)", reps, lookups, [&] {
+        int sum{0};
+        for(std::size_t i{0}; i < lookups; ++i)
+            sum += tileset("tile_label_42").left;
+        impl::do_not_optimize(sum);
+    });
+
+    bench_run("Tileset index lookup", reps, lookups, [&] {
+        int sum{0};
+        for(std::size_t i{0}; i < lookups; ++i)
+            sum += tileset(unsigned(i % 16), unsigned(i % 16)).left;
+        impl::do_not_optimize(sum);
+    });
+}
@@ -0,0 +1,91 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/bench_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <vector>
+
+// Measures the `Vector2.hpp` helpers most used by game code, applied to a
+// large array of vectors.
+
+namespace
+{
+    constexpr std::size_t count{1000000};
+    constexpr std::size_t reps{10};
+
+    auto mkVecs()
+    {
+        std::vector<ssvs::Vec2f> result;
+        result.reserve(count);
+
+        for(std::size_t i{0}; i < count; ++i)
+            result.emplace_back(float(i % 1000) - 500.f, float(i % 777) + 1.f);
+
+        return result;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    using namespace ssvs;
+
+    bench_init(argc, argv);
+
+    const auto source(mkVecs());
+    auto vecs(source);
+    const Vec2f target{100.f, -50.f};
+
+    bench_run("getMag", reps, count, [&] {
+        float sum{0.f};
+        for(const auto& v : vecs) sum += getMag(v);
+        impl::do_not_optimize(sum);
+    });
+
+    bench_run("normalize", reps, count, [&] {
+        vecs = source;
+        for(auto& v : vecs) normalize(v);
+        impl::do_not_optimize(vecs.data());
+    });
+
+    bench_run("getResized", reps, count, [&] {
+        for(auto& v : vecs) v = getResized(v, 3.f);
+        impl::do_not_optimize(vecs.data());
+    });
+
+    bench_run("rotateRadAround", reps, count, [&] {
+        for(auto& v : vecs) rotateRadAround(v, target, 0.01f);
+        impl::do_not_optimize(vecs.data());
+    });
+
+    bench_run("getRadTowards", reps, count, [&] {
+        float sum{0.f};
+        for(const auto& v : source) sum += getRadTowards(v, target);
+        impl::do_not_optimize(sum);
+    });
+
+    bench_run("getDistEuclidean", reps, count, [&] {
+        float sum{0.f};
+        for(const auto& v : source) sum += getDistEuclidean(v, target);
+        impl::do_not_optimize(sum);
+    });
+
+    bench_run("getDotProduct", reps, count, [&] {
+        float sum{0.f};
+        for(const auto& v : source) sum += getDotProduct(v, target);
+        impl::do_not_optimize(sum);
+    });
+
+    bench_run("getVecFromRad", reps, count, [&] {
+        for(std::size_t i{0}; i < count; ++i)
+            vecs[i] = getVecFromRad(float(i) * 0.001f, 2.f);
+        impl::do_not_optimize(vecs.data());
+    });
+
+    bench_run("cClamp", reps, count, [&] {
+        vecs = source;
+        for(auto& v : vecs) cClamp(v, -100.f, 100.f);
+        impl::do_not_optimize(vecs.data());
+    });
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace impl
+{
+    template <typename T>
+    inline void do_not_optimize(const T& x) noexcept
+    {
+        asm volatile("" : : "r,m"(x) : "memory");
+    }
+
+    struct bench_config
+    {
+        std::string suite{"bench"};
+        std::ofstream file;
+        std::ostream* json{nullptr};
+    };
+
+    inline bench_config& get_bench_config()
+    {
+        static bench_config instance;
+        return instance;
+    }
+
+    inline void write_json_string(std::ostream& os, const char* str)
+    {
+        os << '"';
+        for(; *str != '\0'; ++str)
+        {
+            if(*str == '"' || *str == '\\') os << '\\';
+            os << *str;
+        }
+        os << '"';
+    }
+}
+
+/// @brief Parses the benchmark's command line. `--json` prints one JSON
+/// object per benchmark to stdout instead of the table, and `--json=<path>`
+/// appends them to the file at `<path>`.
+inline void bench_init(int argc, char** argv)
+{
+    auto& cfg(impl::get_bench_config());
+
+    if(argc > 0)
+    {
+        const char* name{argv[0]};
+        if(const char* slash = std::strrchr(name, '/')) name = slash + 1;
+        cfg.suite = name;
+    }
+
+    for(int i{1}; i < argc; ++i)
+    {
+        if(std::strcmp(argv[i], "--json") == 0)
+        {
+            cfg.json = &std::cout;
+        }
+        else if(std::strncmp(argv[i], "--json=", 7) == 0)
+        {
+            cfg.file.open(argv[i] + 7, std::ios::app);
+            cfg.json = &cfg.file;
+        }
+    }
+}
+
+/// @brief Runs `f` `reps` times and prints the best time, along with the
+/// throughput of `items` items per repetition.
+template <typename TF>
+inline double bench_run(
+    const char* name, std::size_t reps, std::size_t items, TF&& f)
+{
+    double best{1e30};
+
+    for(std::size_t i{0}; i < reps; ++i)
+    {
+        const auto start(std::chrono::steady_clock::now());
+        f();
+        const auto end(std::chrono::steady_clock::now());
+
+        const auto s(std::chrono::duration<double>(end - start).count());
+        if(s < best) best = s;
+    }
+
+    auto& cfg(impl::get_bench_config());
+
+    if(cfg.json != nullptr)
+    {
+        auto& os(*cfg.json);
+
+        os << "{\"suite\":";
+        impl::write_json_string(os, cfg.suite.c_str());
+        os << ",\"name\":";
+        impl::write_json_string(os, name);
+        os << std::setprecision(9) << ",\"reps\":" << reps
+           << ",\"items\":" << items << ",\"best_ms\":" << best * 1000.0
+           << ",\"items_per_s\":" << items / best << "}\n";
+
+        return best;
+    }
+
+    std::cout << std::setw(32) << std::left << name << std::right
+              << std::fixed << std::setprecision(3) << std::setw(12)
+              << best * 1000.0 << " ms" << std::setw(14)
+              << std::setprecision(2) << items / best / 1e6 << " M/s\n";
+
+    return best;
+}
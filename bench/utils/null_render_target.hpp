@@ -0,0 +1,20 @@
+#pragma once
+
+#include <SFML/Graphics/RenderTarget.hpp>
+
+/// @brief Render target without a GL context. Drawables are still asked to
+/// draw themselves, so their CPU-side preparation runs, but SFML skips the
+/// actual GL calls since the target can never be activated.
+class null_render_target : public sf::RenderTarget
+{
+public:
+    sf::Vector2u getSize() const override
+    {
+        return {1920, 1080};
+    }
+
+    bool setActive(bool) override
+    {
+        return false;
+    }
+};
@@ -0,0 +1,312 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include "SSVStart/Global/Typedefs.hpp"
+#include "SSVStart/Assets/Internal/Extensions.hpp"
+#include "SSVStart/Assets/Internal/Loader.hpp"
+#include "SSVStart/Assets/Internal/MappedFile.hpp"
+
+#include <SSVUtils/Core/Log/Log.hpp>
+#include <SSVUtils/Core/FileSystem/FileSystem.hpp>
+#include <SSVUtils/Core/String/Utils.hpp>
+
+#include <SFML/System/MemoryInputStream.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+namespace ssvs
+{
+
+namespace Impl
+{
+    // Layout, in the host's byte order:
+    //     magic "SSVA", u8 version, 3 padding bytes, u32 entry count
+    //     per entry: u64 offset, u64 size, u32 id length, id bytes
+    //     entry data, each starting at a multiple of `archiveAlignment`
+    inline constexpr char archiveMagic[4]{'S', 'S', 'V', 'A'};
+    inline constexpr std::uint8_t archiveVersion{1};
+    inline constexpr std::uint64_t archiveAlignment{16};
+    inline constexpr std::size_t archiveHeaderSize{12};
+
+    [[nodiscard]] inline std::uint64_t getArchiveAligned(
+        std::uint64_t mX) noexcept
+    {
+        return (mX + archiveAlignment - 1) / archiveAlignment *
+               archiveAlignment;
+    }
+
+    template <typename T>
+    void writeArchiveRaw(std::ostream& mStream, const T& mX)
+    {
+        mStream.write(reinterpret_cast<const char*>(&mX), sizeof(T));
+    }
+} // namespace Impl
+
+/// @brief Packs files into a single archive readable by `AssetArchive`.
+class AssetArchiveWriter
+{
+private:
+    struct Source
+    {
+        std::string id;
+        ssvufs::Path path;
+        std::uint64_t size;
+    };
+
+    std::vector<Source> sources;
+
+public:
+    /// @brief Adds the file at `mPath` under `mId`. Returns false if its
+    /// size cannot be read.
+    bool add(const std::string& mId, const ssvufs::Path& mPath)
+    {
+        std::error_code ec;
+        const auto size(std::filesystem::file_size(mPath.getStr(), ec));
+        if(ec) return false;
+
+        sources.push_back({mId, mPath, size});
+        return true;
+    }
+
+    /// @brief Adds every file under `mRootPath`, with the same ids that
+    /// `AssetFolder` would give them.
+    void addFolder(const ssvufs::Path& mRootPath)
+    {
+        for(const auto& f :
+            ssvufs::getScan<ssvufs::Mode::Recurse, ssvufs::Type::File>(
+                mRootPath))
+        {
+            add(ssvu::getReplaced(f, mRootPath, ""), f);
+        }
+    }
+
+    [[nodiscard]] std::size_t getCount() const noexcept
+    {
+        return sources.size();
+    }
+
+    /// @brief Writes the archive to `mPath`. Returns false on I/O errors.
+    bool write(const std::string& mPath) const
+    {
+        std::ofstream o{mPath, std::ios::binary};
+        if(!o) return false;
+
+        std::uint64_t indexSize{0};
+        for(const auto& s : sources) indexSize += 8 + 8 + 4 + s.id.size();
+
+        o.write(Impl::archiveMagic, sizeof(Impl::archiveMagic));
+        Impl::writeArchiveRaw(o, Impl::archiveVersion);
+        o.write("\0\0\0", 3);
+        Impl::writeArchiveRaw(o, std::uint32_t(sources.size()));
+
+        auto offset(
+            Impl::getArchiveAligned(Impl::archiveHeaderSize + indexSize));
+
+        for(const auto& s : sources)
+        {
+            Impl::writeArchiveRaw(o, offset);
+            Impl::writeArchiveRaw(o, s.size);
+            Impl::writeArchiveRaw(o, std::uint32_t(s.id.size()));
+            o.write(s.id.data(), std::streamsize(s.id.size()));
+
+            offset = Impl::getArchiveAligned(offset + s.size);
+        }
+
+        for(const auto& s : sources)
+        {
+            const auto pos(static_cast<std::uint64_t>(o.tellp()));
+            const auto padding(Impl::getArchiveAligned(pos) - pos);
+            for(std::uint64_t i{0}; i < padding; ++i) o.put('\0');
+
+            std::ifstream i{s.path.getStr(), std::ios::binary};
+            if(!i) return false;
+
+            // Copying an empty file through `rdbuf` would set `failbit`.
+            if(s.size > 0) o << i.rdbuf();
+        }
+
+        return static_cast<bool>(o);
+    }
+};
+
+/// @brief Read-only view of an archive written by `AssetArchiveWriter`.
+/// @details The archive is memory-mapped: entries are handed out as
+/// pointers into the mapping, and loading resources from them does not copy
+/// the file contents. Data and ids stay valid as long as the archive.
+class AssetArchive
+{
+public:
+    struct Entry
+    {
+        const std::byte* data;
+        std::size_t size;
+    };
+
+private:
+    Impl::MappedFile file;
+    std::unordered_map<std::string_view, Entry> entries;
+
+    template <typename T>
+    [[nodiscard]] bool read(std::size_t& mPos, T& mX) const noexcept
+    {
+        if(file.getSize() - mPos < sizeof(T)) return false;
+
+        std::memcpy(&mX, file.getData() + mPos, sizeof(T));
+        mPos += sizeof(T);
+        return true;
+    }
+
+    [[nodiscard]] bool readIndex()
+    {
+        if(file.getSize() < Impl::archiveHeaderSize ||
+            std::memcmp(file.getData(), Impl::archiveMagic,
+                sizeof(Impl::archiveMagic)) != 0)
+            return false;
+
+        std::size_t pos{sizeof(Impl::archiveMagic)};
+        std::uint8_t version;
+        std::uint32_t count;
+
+        if(!read(pos, version) || version != Impl::archiveVersion)
+            return false;
+
+        pos += 3;
+        if(!read(pos, count)) return false;
+
+        entries.reserve(count);
+
+        for(std::uint32_t i{0}; i < count; ++i)
+        {
+            std::uint64_t offset, size;
+            std::uint32_t idSize;
+
+            if(!read(pos, offset) || !read(pos, size) || !read(pos, idSize) ||
+                file.getSize() - pos < idSize ||
+                offset > file.getSize() || size > file.getSize() - offset)
+                return false;
+
+            const std::string_view id{
+                reinterpret_cast<const char*>(file.getData() + pos), idSize};
+            pos += idSize;
+
+            entries.emplace(id,
+                Entry{file.getData() + offset, static_cast<std::size_t>(size)});
+        }
+
+        return true;
+    }
+
+    template <typename T, typename TM>
+    void loadImpl(TM& mMgr, const std::vector<std::string>& mExtensions) const
+    {
+        for(const auto& [id, e] : entries)
+            if(Impl::hasAnyExtension(id, mExtensions))
+                mMgr.template load<T>(std::string{id}, e.data, e.size);
+    }
+
+    template <typename TM>
+    void loadShaders(TM& mMgr, std::string_view mExtension,
+        sf::Shader::Type mType) const
+    {
+        for(const auto& [id, e] : entries)
+        {
+            if(!Impl::hasExtension(id, mExtension)) continue;
+
+            mMgr.template load<sf::Shader>(std::string{id},
+                std::string{reinterpret_cast<const char*>(e.data), e.size},
+                mType, Impl::ShaderFromMemory{});
+        }
+    }
+
+public:
+    AssetArchive() = default;
+
+    /// @brief Opens the archive at `mPath`. Check `isOpen` for failure.
+    AssetArchive(const std::string& mPath)
+    {
+        open(mPath);
+    }
+
+    AssetArchive(const AssetArchive&) = delete;
+    AssetArchive& operator=(const AssetArchive&) = delete;
+
+    /// @brief Opens the archive at `mPath`, closing the previous one.
+    /// Returns false if it cannot be mapped or is malformed.
+    bool open(const std::string& mPath)
+    {
+        entries.clear();
+
+        if(file.open(mPath) && readIndex()) return true;
+
+        entries.clear();
+        file.close();
+        return false;
+    }
+
+    [[nodiscard]] bool isOpen() const noexcept
+    {
+        return file.isOpen();
+    }
+
+    [[nodiscard]] bool has(std::string_view mId) const
+    {
+        return entries.count(mId) > 0;
+    }
+
+    /// @brief Returns the entry for `mId`, or null if there is none.
+    [[nodiscard]] const Entry* find(std::string_view mId) const
+    {
+        const auto itr(entries.find(mId));
+        return itr == entries.end() ? nullptr : &itr->second;
+    }
+
+    /// @brief Returns a stream over the entry for `mId`, for the
+    /// `sf::InputStream` overloads of `load`. Empty if there is none.
+    [[nodiscard]] sf::MemoryInputStream getStream(std::string_view mId) const
+    {
+        sf::MemoryInputStream result;
+
+        if(const auto* e = find(mId))
+            result.open(e->data, e->size);
+        else
+            result.open(nullptr, 0);
+
+        return result;
+    }
+
+    [[nodiscard]] const auto& getEntries() const noexcept
+    {
+        return entries;
+    }
+
+    /// @brief Loads the same resources `AssetFolder::loadToManager` would
+    /// load from the folder the archive was created from. Music and fonts
+    /// keep reading from the mapping, so the archive must outlive `mMgr`.
+    template <typename TM>
+    void loadToManager(TM& mMgr) const
+    {
+        loadImpl<sf::Image>(mMgr, Impl::imageExtensions);
+        loadImpl<sf::Texture>(mMgr, Impl::imageExtensions);
+        loadImpl<sf::SoundBuffer>(mMgr, Impl::soundExtensions);
+        loadImpl<sf::Music>(mMgr, Impl::soundExtensions);
+        loadImpl<sf::Font>(mMgr, Impl::fontExtensions);
+        loadShaders(mMgr, ".vert", sf::Shader::Type::Vertex);
+        loadShaders(mMgr, ".frag", sf::Shader::Type::Fragment);
+
+        ssvu::lo().flush();
+    }
+};
+
+} // namespace ssvs
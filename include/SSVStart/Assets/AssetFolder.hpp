@@ -5,11 +5,18 @@
 #pragma once
 
 #include "SSVStart/Global/Typedefs.hpp"
+#include "SSVStart/GameSystem/JobSystem.hpp"
+#include "SSVStart/Assets/Internal/Extensions.hpp"
 
 #include <SSVUtils/Core/Log/Log.hpp>
 #include <SSVUtils/Core/FileSystem/FileSystem.hpp>
 #include <SSVUtils/Core/String/Utils.hpp>
 
+#include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/Graphics/Image.hpp>
+
+#include <cstddef>
+#include <memory>
 #include <vector>
 #include <string>
 
@@ -36,6 +43,96 @@ private:
         return result;
     }
 
+    struct DecodedImage
+    {
+        ssvufs::Path path;
+        std::unique_ptr<sf::Image> image;
+    };
+
+    struct DecodedSamples
+    {
+        ssvufs::Path path;
+        std::vector<sf::Int16> samples;
+        unsigned int channelCount{0}, sampleRate{0};
+        bool ok{false};
+    };
+
+    [[nodiscard]] auto getId(const ssvufs::Path& mPath) const
+    {
+        return std::string{ssvu::getReplaced(mPath, rootPath, "")};
+    }
+
+    // Called on worker threads: must not log nor touch the manager.
+    static void decode(DecodedImage& mX)
+    {
+        mX.image = std::make_unique<sf::Image>();
+        if(!mX.image->loadFromFile(mX.path)) mX.image.reset();
+    }
+
+    // Called on worker threads: must not log nor touch the manager.
+    static void decode(DecodedSamples& mX)
+    {
+        sf::InputSoundFile file;
+        if(!file.openFromFile(mX.path)) return;
+
+        mX.samples.resize(static_cast<std::size_t>(file.getSampleCount()));
+        mX.channelCount = file.getChannelCount();
+        mX.sampleRate = file.getSampleRate();
+        mX.ok = file.read(mX.samples.data(), mX.samples.size()) ==
+                mX.samples.size();
+    }
+
+    template <typename TM>
+    void loadDecodedImages(TM& mMgr, std::vector<DecodedImage>& mDecoded)
+    {
+        for(auto& d : mDecoded)
+        {
+            const auto id(getId(d.path));
+
+            if(d.image == nullptr)
+            {
+                // Let the sequential path report the failure and apply the
+                // manager's policy for missing resources.
+                mMgr.template load<sf::Image>(id, d.path);
+                mMgr.template load<sf::Texture>(id, d.path);
+                continue;
+            }
+
+            // Only the texture upload needs the GL context.
+            mMgr.template load<sf::Texture>(id, *d.image);
+            mMgr.template adopt<sf::Image>(id, std::move(d.image));
+
+            ssvu::lo("ssvs::AssetFolder::loadToManager(" + rootPath.getStr() +
+                     ")")
+                << id + " image and texture added\n";
+        }
+    }
+
+    template <typename TM>
+    void loadDecodedSoundBuffers(
+        TM& mMgr, std::vector<DecodedSamples>& mDecoded)
+    {
+        for(auto& d : mDecoded)
+        {
+            const auto id(getId(d.path));
+
+            if(!d.ok)
+            {
+                mMgr.template load<sf::SoundBuffer>(id, d.path);
+                continue;
+            }
+
+            mMgr.template load<sf::SoundBuffer>(id, d.samples.data(),
+                d.samples.size(), d.channelCount, d.sampleRate);
+
+            ssvu::lo("ssvs::AssetFolder::loadToManager(" + rootPath.getStr() +
+                     ")")
+                << id + " sound buffer added\n";
+
+            d.samples = {};
+        }
+    }
+
     template <typename T, typename TM>
     void loadImpl(TM& mMgr, const std::vector<std::string>& mExtensions,
         const std::string& mLoTitle)
@@ -50,38 +147,52 @@ private:
         }
     }
 
+    template <typename T, typename TM>
+    void registerImpl(TM& mMgr, const std::vector<std::string>& mExtensions)
+    {
+        for(const auto& f : getFilteredFiles(mExtensions))
+            mMgr.template registerLazy<T>(getId(f), f);
+    }
+
+    template <typename T, typename TG>
+    void addImpl(TG& mGroup, const std::vector<std::string>& mExtensions)
+    {
+        for(const auto& f : getFilteredFiles(mExtensions))
+            mGroup.template add<T>(getId(f), f);
+    }
+
     template <typename TM>
     void loadFontsToManager(TM& mMgr)
     {
-        loadImpl<sf::Font>(
-            mMgr, {".ttf", ".otf", ".pfm"}, "loadFontsToManager");
+        loadImpl<sf::Font>(mMgr, Impl::fontExtensions, "loadFontsToManager");
     }
 
     template <typename TM>
     void loadImagesToManager(TM& mMgr)
     {
         loadImpl<sf::Image>(
-            mMgr, {".png", ".jpg", ".bmp", ".jpeg"}, "loadImagesToManager");
+            mMgr, Impl::imageExtensions, "loadImagesToManager");
     }
 
     template <typename TM>
     void loadTexturesToManager(TM& mMgr)
     {
         loadImpl<sf::Texture>(
-            mMgr, {".png", ".jpg", ".bmp", ".jpeg"}, "loadTexturesToManager");
+            mMgr, Impl::imageExtensions, "loadTexturesToManager");
     }
 
     template <typename TM>
     void loadSoundBuffersToManager(TM& mMgr)
     {
         loadImpl<sf::SoundBuffer>(
-            mMgr, {".wav", ".ogg"}, "loadSoundBuffersToManager");
+            mMgr, Impl::soundExtensions, "loadSoundBuffersToManager");
     }
 
     template <typename TM>
     void loadMusicsToManager(TM& mMgr)
     {
-        loadImpl<sf::Music>(mMgr, {".wav", ".ogg"}, "loadMusicsToManager");
+        loadImpl<sf::Music>(
+            mMgr, Impl::soundExtensions, "loadMusicsToManager");
     }
 
     template <typename TM>
@@ -128,6 +239,80 @@ public:
 
         ssvu::lo().flush();
     }
+
+    /// @brief Registers the same resources as `loadToManager` without
+    /// loading them: each one is loaded by the first access to it, and can
+    /// be evicted by `AssetManager::trimLazy`. Shaders are loaded at once.
+    template <typename TM>
+    void registerToManager(TM& mMgr)
+    {
+        registerImpl<sf::Image>(mMgr, Impl::imageExtensions);
+        registerImpl<sf::Texture>(mMgr, Impl::imageExtensions);
+        registerImpl<sf::SoundBuffer>(mMgr, Impl::soundExtensions);
+        registerImpl<sf::Music>(mMgr, Impl::soundExtensions);
+        registerImpl<sf::Font>(mMgr, Impl::fontExtensions);
+        loadShadersToManager(mMgr);
+
+        ssvu::lo("ssvs::AssetFolder::registerToManager(" + rootPath.getStr() +
+                 ")")
+            << files.size() << " files scanned\n";
+
+        ssvu::lo().flush();
+    }
+
+    /// @brief Adds the same resources as `loadToManager` to `mGroup`, to be
+    /// loaded with it.
+    template <typename TG>
+    void addToGroup(TG& mGroup)
+    {
+        addImpl<sf::Image>(mGroup, Impl::imageExtensions);
+        addImpl<sf::Texture>(mGroup, Impl::imageExtensions);
+        addImpl<sf::SoundBuffer>(mGroup, Impl::soundExtensions);
+        addImpl<sf::Music>(mGroup, Impl::soundExtensions);
+        addImpl<sf::Font>(mGroup, Impl::fontExtensions);
+
+        for(const auto& f : getFilteredFiles({".vert"}))
+            mGroup.template add<sf::Shader>(getId(f), f,
+                sf::Shader::Type::Vertex, Impl::ShaderFromPath{});
+
+        for(const auto& f : getFilteredFiles({".frag"}))
+            mGroup.template add<sf::Shader>(getId(f), f,
+                sf::Shader::Type::Fragment, Impl::ShaderFromPath{});
+    }
+
+    /// @brief Loads the same resources as `loadToManager`, decoding images
+    /// and sound buffers on `mJobs`.
+    /// @details Each image file is decoded once, for both its `sf::Image`
+    /// and its `sf::Texture`. Texture uploads, shader compilation and every
+    /// access to `mMgr` happen on the calling thread, which must own the GL
+    /// context. It also executes decode jobs while waiting for them.
+    template <typename TM>
+    void loadToManager(TM& mMgr, JobSystem& mJobs)
+    {
+        std::vector<DecodedImage> images;
+        std::vector<DecodedSamples> sounds;
+
+        for(auto& f : getFilteredFiles(Impl::imageExtensions))
+            images.push_back({std::move(f), nullptr});
+
+        for(auto& f : getFilteredFiles(Impl::soundExtensions))
+            sounds.push_back({std::move(f), {}, 0, 0, false});
+
+        JobCounter counter;
+
+        for(auto& d : images) mJobs.submit([&d] { decode(d); }, counter);
+        for(auto& d : sounds) mJobs.submit([&d] { decode(d); }, counter);
+
+        mJobs.wait(counter);
+
+        loadDecodedImages(mMgr, images);
+        loadDecodedSoundBuffers(mMgr, sounds);
+        loadMusicsToManager(mMgr);
+        loadFontsToManager(mMgr);
+        loadShadersToManager(mMgr);
+
+        ssvu::lo().flush();
+    }
 };
 
 } // namespace ssvs
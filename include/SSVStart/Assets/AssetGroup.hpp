@@ -0,0 +1,129 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include "SSVStart/Global/Typedefs.hpp"
+
+#include <cassert>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ssvs
+{
+
+/// @brief Named set of resources loaded and unloaded together, like the
+/// assets of a level or a menu. Created by `AssetManager::createGroup`.
+/// @details Resources are reference counted across groups: unloading a
+/// group only frees the resources it loaded that no other loaded group
+/// uses. Resources loaded outside of groups are never freed by them.
+template <typename TM>
+class AssetGroup
+{
+    friend TM;
+
+private:
+    struct Entry
+    {
+        std::function<void(TM&)> acquire;
+        std::function<void(TM&)> release;
+    };
+
+    std::vector<Entry> entries;
+    bool loaded{false};
+
+    // Set by `AssetManager::loadGroup` while the group is loaded.
+    TM* mgr{nullptr};
+
+public:
+    /// @brief Adds a resource, loaded by `AssetManager::loadGroup` with
+    /// `AssetManager::load<T>(mId, mArgs...)`. The arguments are copied.
+    /// If the group is already loaded, the resource is loaded right away.
+    template <typename T, typename... TArgs>
+    AssetGroup& add(const std::string& mId, TArgs&&... mArgs)
+    {
+        auto acquire([mId, args = std::tuple<std::decay_t<TArgs>...>{
+                                FWD(mArgs)...}](TM& mMgr) {
+            std::apply(
+                [&](const auto&... mXs) {
+                    mMgr.template acquire<T>(mId, mXs...);
+                },
+                args);
+        });
+
+        auto release([mId](TM& mMgr) { mMgr.template release<T>(mId); });
+
+        entries.push_back({std::move(acquire), std::move(release)});
+        if(loaded) entries.back().acquire(*mgr);
+
+        return *this;
+    }
+
+    [[nodiscard]] std::size_t getSize() const noexcept
+    {
+        return entries.size();
+    }
+
+    [[nodiscard]] bool isLoaded() const noexcept
+    {
+        return loaded;
+    }
+};
+
+/// @brief Keeps a group loaded for its lifetime. Owned by a `GameState`
+/// through `GameState::keepAlive`, it ties the group to the state.
+template <typename TM>
+class AssetGroupScope
+{
+private:
+    TM* mgr;
+    std::string name;
+
+public:
+    /// @brief Loads the group `mName` of `mMgr`, which must outlive the
+    /// scope.
+    AssetGroupScope(TM& mMgr, std::string_view mName)
+        : mgr{&mMgr}, name{mName}
+    {
+        mgr->loadGroup(name);
+    }
+
+    AssetGroupScope(const AssetGroupScope&) = delete;
+    AssetGroupScope& operator=(const AssetGroupScope&) = delete;
+
+    AssetGroupScope(AssetGroupScope&& mX) noexcept
+        : mgr{std::exchange(mX.mgr, nullptr)}, name{std::move(mX.name)}
+    {
+    }
+
+    AssetGroupScope& operator=(AssetGroupScope&& mX) noexcept
+    {
+        if(this != &mX)
+        {
+            if(mgr != nullptr) mgr->unloadGroup(name);
+
+            mgr = std::exchange(mX.mgr, nullptr);
+            name = std::move(mX.name);
+        }
+
+        return *this;
+    }
+
+    ~AssetGroupScope()
+    {
+        if(mgr != nullptr) mgr->unloadGroup(name);
+    }
+
+    [[nodiscard]] const std::string& getName() const noexcept
+    {
+        return name;
+    }
+};
+
+} // namespace ssvs
@@ -0,0 +1,103 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string_view>
+
+namespace ssvs
+{
+
+namespace Impl
+{
+    template <typename, typename>
+    class ResourceHolder;
+
+    /// @brief 64-bit FNV-1a hash of `mStr`.
+    [[nodiscard]] constexpr std::uint64_t getFnv1a(
+        std::string_view mStr) noexcept
+    {
+        std::uint64_t result{14695981039346656037ull};
+
+        for(const char c : mStr)
+        {
+            result ^= static_cast<unsigned char>(c);
+            result *= 1099511628211ull;
+        }
+
+        return result;
+    }
+} // namespace Impl
+
+/// @brief Hashed asset id. Ids known at compile time can be hashed at
+/// compile time: `constexpr AssetId playerId{"player.png"};`.
+class AssetId
+{
+private:
+    std::uint64_t hash;
+
+public:
+    constexpr AssetId(std::string_view mId) noexcept
+        : hash{Impl::getFnv1a(mId)}
+    {
+    }
+
+    [[nodiscard]] constexpr std::uint64_t getHash() const noexcept
+    {
+        return hash;
+    }
+
+    [[nodiscard]] constexpr bool operator==(AssetId mRhs) const noexcept
+    {
+        return hash == mRhs.hash;
+    }
+};
+
+/// @brief Index of a resource of type `T` in its holder, obtained once
+/// with `AssetManager::getHandle` and valid for the holder's lifetime.
+/// @details Resolving a handle is a single array access, unless it refers
+/// to a lazy resource, which records its use and may load it. If the
+/// resource mapped to its id is replaced, e.g. when an asynchronous load
+/// completes, the handle refers to the new one.
+template <typename T>
+class AssetHandle
+{
+    template <typename, typename>
+    friend class Impl::ResourceHolder;
+
+private:
+    static constexpr std::size_t nullIndex{
+        std::numeric_limits<std::size_t>::max()};
+
+    std::size_t index{nullIndex};
+
+    constexpr explicit AssetHandle(std::size_t mIndex) noexcept
+        : index{mIndex}
+    {
+    }
+
+public:
+    /// @brief Constructs a handle referring to nothing.
+    constexpr AssetHandle() noexcept = default;
+
+    [[nodiscard]] constexpr bool isValid() const noexcept
+    {
+        return index != nullIndex;
+    }
+
+    [[nodiscard]] constexpr std::size_t getIndex() const noexcept
+    {
+        return index;
+    }
+
+    [[nodiscard]] constexpr bool operator==(AssetHandle mRhs) const noexcept
+    {
+        return index == mRhs.index;
+    }
+};
+
+} // namespace ssvs
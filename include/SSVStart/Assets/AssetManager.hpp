@@ -4,13 +4,29 @@
 
 #pragma once
 
+#include "SSVStart/Global/Trace.hpp"
+#include "SSVStart/GameSystem/JobSystem.hpp"
+#include "SSVStart/Assets/AssetGroup.hpp"
+#include "SSVStart/Assets/AssetMemoryReport.hpp"
+#include "SSVStart/Assets/AsyncAsset.hpp"
+#include "SSVStart/Assets/Internal/AsyncLoader.hpp"
 #include "SSVStart/Assets/Internal/ResourceHolder.hpp"
 
 #include <SSVUtils/Core/Log/Log.hpp>
 #include <SSVUtils/Core/MPL/MPL.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <type_traits>
+#include <vector>
 
 namespace sf
 {
@@ -44,7 +60,67 @@ public:
     using ResTpl = typename ResourceTypes::Apply<RHType>::AsTpl;
 
 private:
+    using Clock = std::chrono::steady_clock;
+
+    struct PendingLoadBase
+    {
+        std::string id;
+        std::uintmax_t bytes;
+        std::atomic<bool> decoded{false};
+
+        PendingLoadBase(const std::string& mId, std::uintmax_t mBytes)
+            : id{mId}, bytes{mBytes}
+        {
+        }
+
+        virtual ~PendingLoadBase() = default;
+
+        /// @brief Registers the decoded resource. Returns false if it
+        /// failed to load.
+        virtual bool finish(AssetManager& mMgr) = 0;
+    };
+
+    template <typename T>
+    struct PendingLoad final : PendingLoadBase
+    {
+        typename Impl::AsyncLoader<T>::Decoded result;
+        std::shared_ptr<Impl::AsyncAssetState<T>> state;
+
+        PendingLoad(const std::string& mId, std::uintmax_t mBytes,
+            std::shared_ptr<Impl::AsyncAssetState<T>> mState)
+            : PendingLoadBase{mId, mBytes}, state{std::move(mState)}
+        {
+        }
+
+        bool finish(AssetManager& mMgr) override
+        {
+            auto ptr(Impl::AsyncLoader<T>::finish(std::move(result)));
+            const bool ok(ptr != nullptr);
+
+            // Replace the placeholder registered by `loadAsync`.
+            state->ptr = &mMgr.getRH<T>().adopt(this->id, std::move(ptr));
+            state->ready = true;
+            state->failed = !ok;
+
+            if(ok)
+            {
+                ssvu::lo("ssvs::AssetManager::updateAsync")
+                    << this->id << " resource loaded\n";
+            }
+
+            return ok;
+        }
+    };
+
     ResTpl resTpl;
+    Impl::MemoryCounter memory;
+    Impl::StringMap<AssetGroup<AssetManager>> groups;
+
+    JobSystem* jobSystem{nullptr};
+    JobCounter asyncCounter;
+    std::vector<std::unique_ptr<PendingLoadBase>> pendingLoads;
+    AssetLoadProgress progress;
+    Clock::time_point batchStart;
 
     template <typename T>
     auto& getRH() noexcept
@@ -52,14 +128,362 @@ private:
         return std::get<RHType<T>>(resTpl);
     }
 
+    template <typename T>
+    const auto& getRH() const noexcept
+    {
+        return std::get<RHType<T>>(resTpl);
+    }
+
+    template <typename TRH>
+    static void addToReport(AssetMemoryReport& mReport, const TRH& mRH)
+    {
+        using T = typename TRH::ResType;
+        constexpr auto type(Impl::resourceTypeName<T>);
+
+        std::size_t count{0};
+        mRH.forEachLoaded([&](const std::string& mId, std::size_t mBytes) {
+            mReport.entries.push_back({type, mId, mBytes});
+            ++count;
+        });
+
+        const auto& m(mRH.getMemory());
+        mReport.types.push_back({type, count, m.bytes, m.peakBytes});
+    }
+
+    void refreshElapsed() noexcept
+    {
+        progress.elapsed =
+            std::chrono::duration<float>(Clock::now() - batchStart).count();
+    }
+
 public:
+    AssetManager()
+    {
+        std::apply(
+            [this](auto&... mRHs) { (mRHs.setSharedMemory(memory), ...); },
+            resTpl);
+    }
+
+    AssetManager(const AssetManager&) = delete;
+    AssetManager& operator=(const AssetManager&) = delete;
+
+    ~AssetManager()
+    {
+        // Decode jobs reference the pending loads.
+        if(jobSystem != nullptr) jobSystem->wait(asyncCounter);
+    }
+
+    /// @brief Sets the job system `loadAsync` decodes resources on. Without
+    /// one, `loadAsync` decodes on the calling thread.
+    void setJobSystem(JobSystem& mJobs) noexcept
+    {
+        assert(pendingLoads.empty());
+        jobSystem = &mJobs;
+    }
+
     template <typename T, typename... TArgs>
     T& load(const std::string& mId, TArgs&&... mArgs)
     {
+        SSVS_PROFILE_SCOPE("AssetManager::load");
+
         ssvu::lo("ssvs::AssetManager::load<T>") << mId << " resource loading\n";
         return getRH<T>().load(mId, FWD(mArgs)...);
     }
 
+    /// @brief Registers a resource loaded outside of the manager, e.g.
+    /// decoded on another thread, under `mId`.
+    template <typename T>
+    T& adopt(const std::string& mId, std::unique_ptr<T> mPtr)
+    {
+        assert(canLoad<T>(mId));
+
+        ssvu::lo("ssvs::AssetManager::adopt<T>") << mId << " resource adopted\n";
+        return getRH<T>().adopt(mId, std::move(mPtr));
+    }
+
+    /// @brief Frees the resource mapped to `mId`. Handles to it stay valid
+    /// and resolve like a missing id until it is loaded again. Lazy
+    /// resources stay registered.
+    /// @return Returns false if `mId` was not mapped, or is a lazy resource
+    /// that is not loaded.
+    template <typename T>
+    bool unload(std::string_view mId)
+    {
+        if(!getRH<T>().unload(mId)) return false;
+
+        ssvu::lo("ssvs::AssetManager::unload<T>")
+            << mId << " resource unloaded\n";
+        return true;
+    }
+
+    /// @brief Loads `mId` like `load` if it is not loaded yet, and counts a
+    /// reference to it. Used by asset groups. Ids only mapped to the null
+    /// asset, e.g. by `getHandle`, are loaded.
+    template <typename T, typename... TArgs>
+    T& acquire(const std::string& mId, TArgs&&... mArgs)
+    {
+        auto& rh(getRH<T>());
+
+        const bool mustLoad(rh.canLoad(mId));
+        if(mustLoad) load<T>(mId, FWD(mArgs)...);
+
+        rh.retain(mId, mustLoad);
+        return rh[mId];
+    }
+
+    /// @brief Releases a reference counted by `acquire`, unloading the
+    /// resource with the last one if `acquire` loaded it.
+    template <typename T>
+    void release(std::string_view mId)
+    {
+        if(getRH<T>().release(mId))
+        {
+            ssvu::lo("ssvs::AssetManager::release<T>")
+                << mId << " resource unloaded\n";
+        }
+    }
+
+    template <typename T>
+    [[nodiscard]] std::size_t getRefCount(std::string_view mId) const
+    {
+        return getRH<T>().getRefCount(mId);
+    }
+
+    /// @brief Creates an empty group named `mName`, to be filled with
+    /// `AssetGroup::add` or `AssetFolder::addToGroup`.
+    AssetGroup<AssetManager>& createGroup(const std::string& mName)
+    {
+        assert(!groups.contains(mName));
+        return groups[mName];
+    }
+
+    [[nodiscard]] AssetGroup<AssetManager>& getGroup(std::string_view mName)
+    {
+        const auto itr(groups.find(mName));
+        assert(itr != groups.end());
+
+        return itr->second;
+    }
+
+    [[nodiscard]] bool hasGroup(std::string_view mName) const
+    {
+        return groups.contains(mName);
+    }
+
+    /// @brief Loads every resource of the group `mName` that is not loaded
+    /// yet. Does nothing if the group is already loaded.
+    void loadGroup(std::string_view mName)
+    {
+        SSVS_PROFILE_SCOPE("AssetManager::loadGroup");
+
+        auto& group(getGroup(mName));
+        if(group.loaded) return;
+
+        for(auto& e : group.entries) e.acquire(*this);
+        group.loaded = true;
+        group.mgr = this;
+
+        ssvu::lo("ssvs::AssetManager::loadGroup") << mName << " loaded\n";
+    }
+
+    /// @brief Unloads the resources of the group `mName` that it loaded
+    /// and no other loaded group uses. References to them dangle: call it
+    /// when none are held, e.g. when leaving the state using the group.
+    void unloadGroup(std::string_view mName)
+    {
+        SSVS_PROFILE_SCOPE("AssetManager::unloadGroup");
+
+        auto& group(getGroup(mName));
+        if(!group.loaded) return;
+
+        for(auto itr(group.entries.rbegin()); itr != group.entries.rend();
+            ++itr)
+            itr->release(*this);
+
+        group.loaded = false;
+        group.mgr = nullptr;
+
+        ssvu::lo("ssvs::AssetManager::unloadGroup")
+            << mName << " unloaded\n";
+    }
+
+    /// @brief Maps `mId` to the file at `mPath`, which is loaded by the
+    /// first non-const `get` or handle access. Supports `sf::Font`,
+    /// `sf::Image`, `sf::Texture`, `sf::SoundBuffer` and `sf::Music`.
+    template <typename T>
+    void registerLazy(const std::string& mId, const ssvufs::Path& mPath)
+    {
+        getRH<T>().registerLazy(mId, mPath);
+    }
+
+    /// @brief Sets the bytes lazily loaded resources of type `T` may take
+    /// before `trimLazy` evicts the least recently used ones. Only images,
+    /// textures and sound buffers are measured.
+    template <typename T>
+    void setLazyBudget(std::size_t mBytes) noexcept
+    {
+        getRH<T>().setLazyBudget(mBytes);
+    }
+
+    template <typename T>
+    [[nodiscard]] std::size_t getLazyBytes() const noexcept
+    {
+        return getRH<T>().getLazyBytes();
+    }
+
+    /// @brief Returns true if `mId` is mapped and its resource is in memory.
+    /// Lazy resources count only while loaded.
+    template <typename T>
+    [[nodiscard]] bool isLoaded(std::string_view mId) const
+    {
+        return getRH<T>().isLoaded(mId);
+    }
+
+    /// @brief Evicts lazy resources of every type over its budget. Call it
+    /// between frames, when no reference to them is held.
+    /// @return Returns the number of evicted resources.
+    std::size_t trimLazy()
+    {
+        SSVS_PROFILE_SCOPE("AssetManager::trimLazy");
+
+        return std::apply(
+            [](auto&... mRHs) { return (mRHs.trimLazy() + ...); }, resTpl);
+    }
+
+    /// @brief Starts loading a resource in the background, from a path or
+    /// a memory buffer, which must stay valid until the load completes.
+    /// @details Until then, `mId` is mapped to the null asset of `T`. The
+    /// resource is registered by a later call to `updateAsync`, on the
+    /// thread owning the GL context. Supports `sf::Image`, `sf::Texture`,
+    /// `sf::SoundBuffer` and `sf::Font`.
+    template <typename T, typename... TArgs>
+    AsyncAsset<T> loadAsync(const std::string& mId, TArgs&&... mArgs)
+    {
+        static_assert(Impl::isAsyncLoadable<T>,
+            "This resource type can only be loaded with `load`");
+
+        auto& rh(getRH<T>());
+        assert(rh.canLoad(mId));
+
+        if(progress.isDone())
+        {
+            progress = {};
+            batchStart = Clock::now();
+        }
+
+        const auto bytes(Impl::getSourceSize(mArgs...));
+        ++progress.requested;
+        progress.bytesRequested += bytes;
+
+        auto state(std::make_shared<Impl::AsyncAssetState<T>>());
+        state->ptr = Impl::DefResHelper<T>::get();
+        rh.setPlaceholder(mId, state->ptr);
+
+        auto& pending(*pendingLoads.emplace_back(
+            std::make_unique<PendingLoad<T>>(mId, bytes, state)));
+
+        auto decode([p = static_cast<PendingLoad<T>*>(&pending),
+                        args = std::tuple<std::decay_t<TArgs>...>{
+                            FWD(mArgs)...}] {
+            p->result = std::apply(
+                [](const auto&... mXs) {
+                    return Impl::AsyncLoader<T>::decode(mXs...);
+                },
+                args);
+
+            p->decoded.store(true, std::memory_order_release);
+        });
+
+        if(jobSystem != nullptr)
+            jobSystem->submit(std::move(decode), asyncCounter);
+        else
+            decode();
+
+        ssvu::lo("ssvs::AssetManager::loadAsync<T>")
+            << mId << " resource queued\n";
+
+        return {std::move(state)};
+    }
+
+    /// @brief Registers the resources decoded since the last call. Call it
+    /// once per frame while loads are pending.
+    /// @param mMaxFinished Maximum number of resources to register, to bound
+    /// the time spent uploading textures in a single frame.
+    /// @return Returns the number of resources registered.
+    std::size_t updateAsync(
+        std::size_t mMaxFinished = std::numeric_limits<std::size_t>::max())
+    {
+        SSVS_PROFILE_SCOPE("AssetManager::updateAsync");
+
+        std::size_t finished{0};
+
+        for(auto& p : pendingLoads)
+        {
+            if(finished == mMaxFinished) break;
+            if(!p->decoded.load(std::memory_order_acquire)) continue;
+
+            ++(p->finish(*this) ? progress.loaded : progress.failed);
+            progress.bytesCompleted += p->bytes;
+
+            p.reset();
+            ++finished;
+        }
+
+        pendingLoads.erase(
+            std::remove(pendingLoads.begin(), pendingLoads.end(), nullptr),
+            pendingLoads.end());
+
+        if(finished > 0) refreshElapsed();
+        return finished;
+    }
+
+    /// @brief Blocks until every pending load has been registered.
+    void finishAsync()
+    {
+        if(jobSystem != nullptr) jobSystem->wait(asyncCounter);
+        updateAsync();
+    }
+
+    [[nodiscard]] bool isLoadingAsync() const noexcept
+    {
+        return !pendingLoads.empty();
+    }
+
+    /// @brief Returns the progress of the current batch of asynchronous
+    /// loads, or of the last one if all of them have completed.
+    [[nodiscard]] AssetLoadProgress getLoadProgress() noexcept
+    {
+        if(!progress.isDone()) refreshElapsed();
+        return progress;
+    }
+
+    /// @brief Returns the estimated bytes held by the resources of every
+    /// type, with a breakdown per type and per resource.
+    [[nodiscard]] AssetMemoryReport getMemoryReport() const
+    {
+        AssetMemoryReport result;
+        result.totalBytes = memory.bytes;
+        result.peakBytes = memory.peakBytes;
+
+        std::apply(
+            [&result](const auto&... mRHs) {
+                (addToReport(result, mRHs), ...);
+            },
+            resTpl);
+
+        result.sortEntries();
+        return result;
+    }
+
+    /// @brief Lowers the peaks of the memory report to the current usage,
+    /// e.g. to measure each level separately.
+    void resetMemoryPeaks() noexcept
+    {
+        memory.resetPeak();
+        std::apply([](auto&... mRHs) { (mRHs.resetMemoryPeak(), ...); },
+            resTpl);
+    }
+
     template <typename T>
     auto& getAll()
     {
@@ -67,16 +491,61 @@ public:
     }
 
     template <typename T>
-    bool has(const std::string& mId)
+    const auto& getAll() const
+    {
+        return getRH<T>().getResources();
+    }
+
+    template <typename T>
+    [[nodiscard]] bool has(std::string_view mId) const noexcept
     {
         return getRH<T>().has(mId);
     }
 
+    /// @brief Returns true if `load` can map `mId`: it is not mapped, or
+    /// only to the null asset, e.g. by `getHandle` or by a failed load.
     template <typename T>
-    T& get(const std::string& mId)
+    [[nodiscard]] bool canLoad(std::string_view mId) const
+    {
+        return getRH<T>().canLoad(mId);
+    }
+
+    /// @brief Returns the resource mapped to `mId`. Missing ids are handled
+    /// by the missing resource policy, without being mapped.
+    template <typename T>
+    [[nodiscard]] T& get(std::string_view mId)
     {
         return getRH<T>()[mId];
     }
+
+    template <typename T>
+    [[nodiscard]] const T& get(std::string_view mId) const
+    {
+        return getRH<T>()[mId];
+    }
+
+    /// @brief Resolves `mId` once, for repeated access with
+    /// `get(AssetHandle<T>)`. Missing ids are handled by the missing
+    /// resource policy, and stay mapped so the handle can be resolved.
+    template <typename T>
+    [[nodiscard]] AssetHandle<T> getHandle(std::string_view mId)
+    {
+        return getRH<T>().getHandle(mId);
+    }
+
+    /// @brief Resolves an id hashed at compile time. Returns an invalid
+    /// handle if no resource is mapped to it.
+    template <typename T>
+    [[nodiscard]] AssetHandle<T> getHandle(AssetId mId)
+    {
+        return getRH<T>().getHandle(mId);
+    }
+
+    template <typename T>
+    [[nodiscard]] T& get(AssetHandle<T> mHandle)
+    {
+        return getRH<T>()[mHandle];
+    }
 };
 
 class DefaultAssetManager : public AssetManager<RHPolicyDefault>
@@ -0,0 +1,187 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ssvs
+{
+
+template <typename>
+class AssetManager;
+
+/// @brief Snapshot of the memory held by the resources of an
+/// `AssetManager`, returned by `AssetManager::getMemoryReport`.
+/// @details Byte counts are estimates: decoded pixels and samples, one
+/// second of samples for streamed music, and the source data of fonts.
+/// Shaders, bitmap fonts and tilesets count as zero.
+class AssetMemoryReport
+{
+    template <typename>
+    friend class AssetManager;
+
+public:
+    struct Entry
+    {
+        std::string_view type;
+        std::string id;
+        std::size_t bytes;
+    };
+
+    struct TypeTotals
+    {
+        std::string_view type;
+        std::size_t count, bytes, peakBytes;
+    };
+
+private:
+    std::vector<Entry> entries;
+    std::vector<TypeTotals> types;
+    std::size_t totalBytes{0}, peakBytes{0};
+
+    void sortEntries()
+    {
+        std::sort(entries.begin(), entries.end(),
+            [](const Entry& mA, const Entry& mB) {
+                return mA.bytes > mB.bytes;
+            });
+    }
+
+public:
+    [[nodiscard]] std::size_t getTotalBytes() const noexcept
+    {
+        return totalBytes;
+    }
+
+    /// @brief Returns the highest total since the manager was created, or
+    /// since `AssetManager::resetMemoryPeaks`.
+    [[nodiscard]] std::size_t getPeakBytes() const noexcept
+    {
+        return peakBytes;
+    }
+
+    /// @brief Returns the totals of each resource type, in the order of
+    /// `AssetManager::ResourceTypes`.
+    [[nodiscard]] const auto& getTypes() const noexcept
+    {
+        return types;
+    }
+
+    /// @brief Returns every resource in memory, largest first.
+    [[nodiscard]] const auto& getEntries() const noexcept
+    {
+        return entries;
+    }
+
+    /// @brief Returns the resources larger than `mBytes`, largest first:
+    /// useful to catch oversized textures.
+    [[nodiscard]] std::vector<const Entry*> getLargerThan(
+        std::size_t mBytes) const
+    {
+        std::vector<const Entry*> result;
+
+        for(const auto& e : entries)
+        {
+            if(e.bytes <= mBytes) break;
+            result.emplace_back(&e);
+        }
+
+        return result;
+    }
+
+    /// @brief Returns the bytes of the resources whose id starts with
+    /// `mPrefix`, e.g. `"Sprites/"`.
+    [[nodiscard]] std::size_t getBytesWithPrefix(
+        std::string_view mPrefix) const noexcept
+    {
+        std::size_t result{0};
+
+        for(const auto& e : entries)
+            if(std::string_view{e.id}.substr(0, mPrefix.size()) == mPrefix)
+                result += e.bytes;
+
+        return result;
+    }
+
+    /// @brief Groups the resources by the first `mDepth` components of their
+    /// ids, split on `mSeparator`, and returns the totals, largest first.
+    [[nodiscard]] std::vector<std::pair<std::string, std::size_t>>
+    getPrefixTotals(std::size_t mDepth = 1, char mSeparator = '/') const
+    {
+        std::vector<std::pair<std::string, std::size_t>> result;
+
+        for(const auto& e : entries)
+        {
+            auto end(std::string::npos);
+            for(std::size_t i{0}, from{0}; i < mDepth; ++i, from = end + 1)
+            {
+                end = e.id.find(mSeparator, from);
+                if(end == std::string::npos) break;
+            }
+
+            // Ids with fewer components than `mDepth` are grouped whole.
+            const auto prefix(e.id.substr(0, end));
+
+            const auto itr(std::find_if(result.begin(), result.end(),
+                [&](const auto& mX) { return mX.first == prefix; }));
+
+            if(itr == result.end())
+                result.emplace_back(prefix, e.bytes);
+            else
+                itr->second += e.bytes;
+        }
+
+        std::sort(result.begin(), result.end(),
+            [](const auto& mA, const auto& mB) {
+                return mA.second > mB.second;
+            });
+
+        return result;
+    }
+
+    /// @brief Prints the totals of each type, followed by the `mMaxEntries`
+    /// largest resources. The format of `mStream` is restored afterwards.
+    void print(std::ostream& mStream, std::size_t mMaxEntries = 10) const
+    {
+        const auto kib([](std::size_t mBytes) { return mBytes / 1024.0; });
+
+        const auto flags(mStream.flags());
+        const auto precision(mStream.precision());
+
+        mStream << std::fixed << std::setprecision(1) << "Assets: "
+                << kib(totalBytes) << " KiB (peak " << kib(peakBytes)
+                << " KiB)\n";
+
+        for(const auto& t : types)
+        {
+            if(t.count == 0 && t.peakBytes == 0) continue;
+
+            mStream << "  " << std::setw(12) << std::left << t.type
+                    << std::right << std::setw(6) << t.count << std::setw(12)
+                    << kib(t.bytes) << " KiB (peak " << kib(t.peakBytes)
+                    << " KiB)\n";
+        }
+
+        const auto count(std::min(mMaxEntries, entries.size()));
+        for(std::size_t i{0}; i < count; ++i)
+        {
+            mStream << "  " << std::setw(12) << kib(entries[i].bytes)
+                    << " KiB  " << entries[i].type << ' ' << entries[i].id
+                    << '\n';
+        }
+
+        mStream.flags(flags);
+        mStream.precision(precision);
+    }
+};
+
+} // namespace ssvs
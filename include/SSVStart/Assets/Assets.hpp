@@ -5,5 +5,11 @@
 #pragma once
 
 #include "SSVStart/Global/Typedefs.hpp"
+#include "SSVStart/Assets/AssetHandle.hpp"
+#include "SSVStart/Assets/AssetGroup.hpp"
+#include "SSVStart/Assets/AssetMemoryReport.hpp"
+#include "SSVStart/Assets/AsyncAsset.hpp"
 #include "SSVStart/Assets/AssetManager.hpp"
 #include "SSVStart/Assets/AssetFolder.hpp"
+#include "SSVStart/Assets/AssetArchive.hpp"
+#include "SSVStart/Assets/TextureAtlas.hpp"
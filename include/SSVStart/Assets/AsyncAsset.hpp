@@ -0,0 +1,113 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace ssvs
+{
+
+template <typename>
+class AssetManager;
+
+namespace Impl
+{
+    template <typename T>
+    struct AsyncAssetState
+    {
+        T* ptr;
+        bool ready{false}, failed{false};
+    };
+} // namespace Impl
+
+/// @brief Handle to a resource requested with `AssetManager::loadAsync`.
+/// @details Until the load completes, it refers to the placeholder also
+/// returned by `AssetManager::get`: the null asset of the type, if it has
+/// one. Must only be used on the thread calling `AssetManager::updateAsync`.
+template <typename T>
+class AsyncAsset
+{
+    template <typename>
+    friend class AssetManager;
+
+private:
+    std::shared_ptr<Impl::AsyncAssetState<T>> state;
+
+    AsyncAsset(std::shared_ptr<Impl::AsyncAssetState<T>> mState) noexcept
+        : state{std::move(mState)}
+    {
+    }
+
+public:
+    /// @brief Returns true once the resource has been loaded, or has
+    /// failed to load.
+    [[nodiscard]] bool isReady() const noexcept
+    {
+        return state->ready;
+    }
+
+    [[nodiscard]] bool isFailed() const noexcept
+    {
+        return state->failed;
+    }
+
+    /// @brief Returns the resource, or its placeholder while loading. May be
+    /// null for types without a null asset.
+    [[nodiscard]] T* getPtr() const noexcept
+    {
+        return state->ptr;
+    }
+
+    [[nodiscard]] T& get() const noexcept
+    {
+        assert(state->ptr != nullptr);
+        return *state->ptr;
+    }
+};
+
+/// @brief Aggregate progress of the asynchronous loads requested since the
+/// last time all of them had completed.
+struct AssetLoadProgress
+{
+    std::size_t requested{0}, loaded{0}, failed{0};
+
+    /// @brief Source bytes of all the requests and of the completed ones,
+    /// failed included. Sources of unknown size count as zero.
+    std::uintmax_t bytesRequested{0}, bytesCompleted{0};
+
+    /// @brief Seconds elapsed since the first request of the batch.
+    float elapsed{0.f};
+
+    [[nodiscard]] bool isDone() const noexcept
+    {
+        return loaded + failed == requested;
+    }
+
+    /// @brief Returns the completed fraction in [0, 1], weighted by bytes
+    /// when the sizes of the sources are known.
+    [[nodiscard]] float getRatio() const noexcept
+    {
+        if(isDone()) return 1.f;
+        if(bytesRequested > 0) return float(bytesCompleted) / bytesRequested;
+
+        return float(loaded + failed) / requested;
+    }
+
+    /// @brief Estimates the seconds left from the throughput so far. Empty
+    /// until something has completed.
+    [[nodiscard]] std::optional<float> getEta() const noexcept
+    {
+        const auto ratio(getRatio());
+        if(ratio <= 0.f) return std::nullopt;
+
+        return elapsed * (1.f - ratio) / ratio;
+    }
+};
+
+} // namespace ssvs
@@ -0,0 +1,147 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include "SSVStart/Assets/Internal/Loader.hpp"
+#include "SSVStart/Assets/Internal/ResourceSize.hpp"
+
+#include <SSVUtils/Core/FileSystem/Path.hpp>
+
+#include <SFML/Audio/InputSoundFile.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace ssvs::Impl
+{
+
+/// @brief Splits loading a resource of type `T` into `decode`, which runs
+/// on a worker thread and must neither log nor touch GL, and `finish`, which
+/// runs on the thread owning the GL context.
+/// @details Only types whose loading is dominated by CPU work are
+/// specialized. Sources are a path or a memory buffer.
+template <typename T>
+struct AsyncLoader;
+
+// Image and Font loading never touches GL or OpenAL: all of it can happen
+// on the worker.
+template <typename T>
+struct AsyncLoaderCPU
+{
+    using Decoded = std::unique_ptr<T>;
+
+    [[nodiscard]] static Decoded decode(const ssvufs::Path& mPath)
+    {
+        auto result(std::make_unique<T>());
+        if(!result->loadFromFile(mPath)) result.reset();
+        return result;
+    }
+
+    [[nodiscard]] static Decoded decode(const void* mData, std::size_t mSize)
+    {
+        auto result(std::make_unique<T>());
+        if(!result->loadFromMemory(mData, mSize)) result.reset();
+        return result;
+    }
+
+    [[nodiscard]] static std::unique_ptr<T> finish(Decoded&& mDecoded)
+    {
+        return std::move(mDecoded);
+    }
+};
+
+template <>
+struct AsyncLoader<sf::Image> : AsyncLoaderCPU<sf::Image>
+{
+};
+
+template <>
+struct AsyncLoader<sf::Font> : AsyncLoaderCPU<sf::Font>
+{
+};
+
+// Textures are decoded into an image on the worker, then uploaded.
+template <>
+struct AsyncLoader<sf::Texture>
+{
+    using Decoded = std::unique_ptr<sf::Image>;
+
+    template <typename... TArgs>
+    [[nodiscard]] static Decoded decode(const TArgs&... mArgs)
+    {
+        return AsyncLoader<sf::Image>::decode(mArgs...);
+    }
+
+    [[nodiscard]] static std::unique_ptr<sf::Texture> finish(
+        Decoded&& mDecoded)
+    {
+        if(mDecoded == nullptr) return nullptr;
+        return Loader<sf::Texture>::load(*mDecoded);
+    }
+};
+
+// Sound files are decoded into samples on the worker. The buffer, which
+// owns an OpenAL resource, is created afterwards.
+template <>
+struct AsyncLoader<sf::SoundBuffer>
+{
+    struct Decoded
+    {
+        std::vector<sf::Int16> samples;
+        unsigned int channelCount{0}, sampleRate{0};
+        bool ok{false};
+    };
+
+    [[nodiscard]] static Decoded decodeFrom(sf::InputSoundFile& mFile)
+    {
+        Decoded result;
+        result.samples.resize(
+            static_cast<std::size_t>(mFile.getSampleCount()));
+        result.channelCount = mFile.getChannelCount();
+        result.sampleRate = mFile.getSampleRate();
+        result.ok = mFile.read(result.samples.data(), result.samples.size()) ==
+                    result.samples.size();
+        return result;
+    }
+
+    [[nodiscard]] static Decoded decode(const ssvufs::Path& mPath)
+    {
+        sf::InputSoundFile file;
+        if(!file.openFromFile(mPath)) return {};
+        return decodeFrom(file);
+    }
+
+    [[nodiscard]] static Decoded decode(const void* mData, std::size_t mSize)
+    {
+        sf::InputSoundFile file;
+        if(!file.openFromMemory(mData, mSize)) return {};
+        return decodeFrom(file);
+    }
+
+    [[nodiscard]] static std::unique_ptr<sf::SoundBuffer> finish(
+        Decoded&& mDecoded)
+    {
+        if(!mDecoded.ok) return nullptr;
+
+        return Loader<sf::SoundBuffer>::load(mDecoded.samples.data(),
+            mDecoded.samples.size(), mDecoded.channelCount,
+            mDecoded.sampleRate);
+    }
+};
+
+template <typename T, typename = void>
+inline constexpr bool isAsyncLoadable{false};
+
+template <typename T>
+inline constexpr bool
+    isAsyncLoadable<T, std::void_t<typename AsyncLoader<T>::Decoded>>{true};
+
+} // namespace ssvs::Impl
@@ -0,0 +1,37 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ssvs::Impl
+{
+
+// File extensions recognized when loading a whole folder or archive.
+inline const std::vector<std::string> fontExtensions{".ttf", ".otf", ".pfm"};
+inline const std::vector<std::string> imageExtensions{
+    ".png", ".jpg", ".bmp", ".jpeg"};
+inline const std::vector<std::string> soundExtensions{".wav", ".ogg"};
+
+[[nodiscard]] inline bool hasExtension(
+    std::string_view mPath, std::string_view mExtension) noexcept
+{
+    return mPath.size() >= mExtension.size() &&
+           mPath.compare(mPath.size() - mExtension.size(), mExtension.size(),
+               mExtension) == 0;
+}
+
+[[nodiscard]] inline bool hasAnyExtension(std::string_view mPath,
+    const std::vector<std::string>& mExtensions) noexcept
+{
+    for(const auto& e : mExtensions)
+        if(hasExtension(mPath, e)) return true;
+
+    return false;
+}
+
+} // namespace ssvs::Impl
@@ -11,6 +11,7 @@
 #include <SSVUtils/Core/FileSystem/Path.hpp>
 
 #include <cstddef>
+#include <type_traits>
 
 namespace ssvs::Impl
 {
@@ -126,4 +127,13 @@ struct Loader<Tileset> // Tileset has unique syntax
     }
 };
 
+/// @brief True for the types that can be loaded from a path alone, and can
+/// therefore be registered for lazy loading.
+template <typename T>
+inline constexpr bool isLoadableFromPath{std::is_same_v<T, sf::Font> ||
+                                         std::is_same_v<T, sf::Image> ||
+                                         std::is_same_v<T, sf::Texture> ||
+                                         std::is_same_v<T, sf::SoundBuffer> ||
+                                         std::is_same_v<T, sf::Music>};
+
 } // namespace ssvs::Impl
@@ -0,0 +1,143 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ssvs::Impl
+{
+
+/// @brief Read-only memory mapping of a whole file.
+class MappedFile
+{
+private:
+    const std::byte* data{nullptr};
+    std::size_t size{0};
+
+#ifdef _WIN32
+    HANDLE file{INVALID_HANDLE_VALUE}, mapping{nullptr};
+#endif
+
+public:
+    MappedFile() = default;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile()
+    {
+        close();
+    }
+
+    void close() noexcept
+    {
+#ifdef _WIN32
+        if(data != nullptr) UnmapViewOfFile(data);
+        if(mapping != nullptr) CloseHandle(mapping);
+        if(file != INVALID_HANDLE_VALUE) CloseHandle(file);
+
+        file = INVALID_HANDLE_VALUE;
+        mapping = nullptr;
+#else
+        if(data != nullptr) munmap(const_cast<std::byte*>(data), size);
+#endif
+
+        data = nullptr;
+        size = 0;
+    }
+
+    /// @brief Maps the file at `mPath`, unmapping the previous one. Returns
+    /// false on failure, or if the file is empty.
+    [[nodiscard]] bool open(const std::string& mPath)
+    {
+        close();
+
+#ifdef _WIN32
+        file = CreateFileA(mPath.c_str(), GENERIC_READ, FILE_SHARE_READ,
+            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if(file == INVALID_HANDLE_VALUE) return false;
+
+        LARGE_INTEGER fileSize;
+        if(!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+        {
+            close();
+            return false;
+        }
+
+        mapping =
+            CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if(mapping == nullptr)
+        {
+            close();
+            return false;
+        }
+
+        data = static_cast<const std::byte*>(
+            MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+        if(data == nullptr)
+        {
+            close();
+            return false;
+        }
+
+        size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+        const int fd(::open(mPath.c_str(), O_RDONLY));
+        if(fd < 0) return false;
+
+        struct stat st;
+        if(fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        void* ptr(mmap(nullptr, static_cast<std::size_t>(st.st_size),
+            PROT_READ, MAP_PRIVATE, fd, 0));
+
+        // The mapping stays valid after closing the descriptor.
+        ::close(fd);
+        if(ptr == MAP_FAILED) return false;
+
+        data = static_cast<const std::byte*>(ptr);
+        size = static_cast<std::size_t>(st.st_size);
+#endif
+
+        return true;
+    }
+
+    [[nodiscard]] bool isOpen() const noexcept
+    {
+        return data != nullptr;
+    }
+
+    [[nodiscard]] const std::byte* getData() const noexcept
+    {
+        return data;
+    }
+
+    [[nodiscard]] std::size_t getSize() const noexcept
+    {
+        return size;
+    }
+};
+
+} // namespace ssvs::Impl
@@ -8,6 +8,7 @@
 #include "SSVStart/Assets/Internal/DefaultAssets.hpp"
 
 #include <string>
+#include <string_view>
 #include <utility>
 #include <memory>
 #include <cassert>
@@ -21,56 +22,72 @@ struct RHPolicyAssert
     auto& load(TR& mRH, const std::string& mId, TArgs&&... mArgs)
     {
         using ResType = typename TR::ResType;
+        return adopt(mRH, mId, Impl::Loader<ResType>::load(mArgs...));
+    }
 
-        auto uptr(std::move(Impl::Loader<ResType>::load(mArgs...)));
-        mRH.ownership.emplace_back(std::move(uptr));
-        return mRH.emplaceAndGet(mId, uptr.get());
+    template <typename TR, typename TPtr>
+    auto& adopt(TR& mRH, const std::string& mId, TPtr&& mPtr)
+    {
+        assert(mPtr != nullptr);
+        return mRH.emplaceOwned(mId, std::move(mPtr));
     }
 
-#ifndef NDEBUG
-    template <typename T>
-    void checkMissing(T& mRH, const std::string& mId)
+    /// @brief Called by lookups of ids no resource is mapped to.
+    template <typename TR>
+    typename TR::ResType* getMissing(
+        const TR&, std::string_view) const noexcept
     {
-        assert(mRH.has(mId));
+        assert(false && "Missing resource");
+        return nullptr;
     }
-#else
-    template <typename T>
-    void checkMissing(T&, const std::string&)
+
+    /// @brief Called before mapping `mId` to a handle.
+    template <typename TR>
+    void checkMissing([[maybe_unused]] TR& mRH,
+        [[maybe_unused]] std::string_view mId) const noexcept
     {
+        assert(mRH.has(mId));
     }
-#endif
 };
 
 struct RHPolicyDefault
 {
     template <typename TR, typename... TArgs>
     auto& load(TR& mRH, const std::string& mId, TArgs&&... mArgs)
+    {
+        using ResType = typename TR::ResType;
+        return adopt(mRH, mId, Impl::Loader<ResType>::load(mArgs...));
+    }
+
+    template <typename TR, typename TPtr>
+    auto& adopt(TR& mRH, const std::string& mId, TPtr&& mPtr)
     {
         using ResType = typename TR::ResType;
 
-        auto uptr(std::move(Impl::Loader<ResType>::load(mArgs...)));
-        ResType* ptr;
+        if(mPtr == nullptr)
+            return mRH.emplaceAndGet(mId, Impl::DefResHelper<ResType>::get());
 
-        if(uptr == nullptr)
-        {
-            ptr = Impl::DefResHelper<ResType>::get();
-        }
-        else
-        {
-            ptr = uptr.get();
-            mRH.ownership.emplace_back(std::move(uptr));
-        }
+        return mRH.emplaceOwned(mId, std::move(mPtr));
+    }
 
-        return mRH.emplaceAndGet(mId, ptr);
+    /// @brief Called by lookups of ids no resource is mapped to. Does not
+    /// map them, so that reads never allocate.
+    template <typename TR>
+    typename TR::ResType* getMissing(
+        const TR&, std::string_view) const noexcept
+    {
+        return Impl::DefResHelper<typename TR::ResType>::get();
     }
 
-    template <typename T>
-    void checkMissing(T& mRH, const std::string& mId)
+    /// @brief Called before mapping `mId` to a handle. Maps a missing id to
+    /// the null asset, which a later load replaces.
+    template <typename TR>
+    void checkMissing(TR& mRH, std::string_view mId)
     {
-        using ResType = typename T::ResType;
+        using ResType = typename TR::ResType;
 
         if(mRH.has(mId)) return;
-        mRH.resources[mId] = Impl::DefResHelper<ResType>::get();
+        mRH.emplaceAndGet(std::string{mId}, Impl::DefResHelper<ResType>::get());
     }
 };
 
@@ -4,13 +4,25 @@
 
 #pragma once
 
+#include "SSVStart/Assets/AssetHandle.hpp"
 #include "SSVStart/Assets/Internal/Loader.hpp"
 #include "SSVStart/Assets/Internal/DefaultAssets.hpp"
 #include "SSVStart/Assets/Internal/Policies.hpp"
+#include "SSVStart/Assets/Internal/ResourceSize.hpp"
+#include "SSVStart/Assets/Internal/StringHash.hpp"
 
+#include <SSVUtils/Core/FileSystem/Path.hpp>
+#include <SSVUtils/Core/Log/Log.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <vector>
 #include <unordered_map>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <memory>
 #include <cassert>
 
@@ -28,44 +40,574 @@ public:
     TPolicy policy;
 
 private:
+    // Resources registered with `registerLazy`, loaded on first access and
+    // possibly evicted by `trimLazy`.
+    struct LazyEntry
+    {
+        ssvufs::Path path;
+        std::unique_ptr<T> resource;
+        std::size_t slot, bytes{0};
+        bool failed{false};
+    };
+
+    static constexpr std::size_t noSlot{
+        std::numeric_limits<std::size_t>::max()};
+    static constexpr std::size_t lazyBit{~(noSlot >> 1)};
+
+    // Owned resources, with the slot each is mapped to, or `noSlot` for
+    // the ones `adopt` replaced.
     std::vector<std::unique_ptr<T>> ownership;
-    std::unordered_map<std::string, T*> resources;
+    std::vector<std::size_t> ownerSlots;
+    StringMap<T*> resources;
+    StringMap<LazyEntry> lazy;
+
+    struct SlotInfo
+    {
+        std::string id;
+        std::size_t bytes{0};
+
+        // References from asset groups. `unloadable` is set if a group
+        // loaded the resource, which is then unloaded with the last one.
+        std::size_t refs{0};
+        bool unloadable{false};
+
+        // Set while `setPlaceholder` maps the id, e.g. during an
+        // asynchronous load.
+        bool placeholder{false};
+
+        // Set for the slots of lazy resources.
+        LazyEntry* lazyEntry{nullptr};
+
+        // Index of the mapped resource in `ownership`, if owned.
+        std::size_t owner{noSlot};
+    };
+
+    // Dense storage backing `AssetHandle<T>`, indexed by the hash of the
+    // ids. A slot is never removed, so that handles stay valid. Lazy
+    // resources that are not loaded and unloaded ones have a null slot.
+    // Ids whose hash collides with an earlier one get a slot of their own,
+    // only found through `collidedSlots`.
+    // Handles to lazy resources have `lazyBit` set in their index, so that
+    // only they take the path recording uses and loading on demand.
+    std::vector<T*> slots;
+    std::vector<std::uint64_t> slotUses;
+    std::vector<SlotInfo> slotInfos;
+    std::unordered_map<std::uint64_t, std::size_t> slotIndices;
+    StringMap<std::size_t> collidedSlots;
+
+    MemoryCounter memory;
+    MemoryCounter* sharedMemory{nullptr};
+
+    // Advanced by `trimLazy`: accesses are ordered by the call they
+    // follow, so that recording one is a plain store.
+    std::uint64_t useClock{0};
+    std::size_t lazyBytes{0};
+    std::size_t lazyBudget{std::numeric_limits<std::size_t>::max()};
+
+    // Null assets and placeholders are shared, and not accounted for.
+    [[nodiscard]] static bool isOwned(const T* mPtr) noexcept
+    {
+        return mPtr != nullptr && mPtr != DefResHelper<T>::get();
+    }
+
+    // Fonts keep their source data around for the lifetime of their face.
+    template <typename... TArgs>
+    [[nodiscard]] static std::size_t getSourceBytes(const TArgs&... mArgs)
+    {
+        if constexpr(std::is_same_v<T, sf::Font> &&
+                     requires { getSourceSize(mArgs...); })
+            return static_cast<std::size_t>(getSourceSize(mArgs...));
+        else
+            return 0;
+    }
+
+    void setSlotBytes(std::size_t mI, std::size_t mBytes) noexcept
+    {
+        auto& bytes(slotInfos[mI].bytes);
+        memory.remove(bytes);
+        memory.add(mBytes);
+
+        if(sharedMemory != nullptr)
+        {
+            sharedMemory->remove(bytes);
+            sharedMemory->add(mBytes);
+        }
+
+        bytes = mBytes;
+    }
+
+    // Returns the slot of `mId`, or `noSlot` if it has none.
+    [[nodiscard]] std::size_t findSlot(std::string_view mId) const
+    {
+        const auto itr(slotIndices.find(AssetId{mId}.getHash()));
+        if(itr == slotIndices.end()) return noSlot;
+        if(slotInfos[itr->second].id == mId) [[likely]]
+            return itr->second;
+
+        const auto collided(collidedSlots.find(mId));
+        return collided == collidedSlots.end() ? noSlot : collided->second;
+    }
+
+    std::size_t emplaceSlot(const std::string& mId, T* mPtr)
+    {
+        auto i(findSlot(mId));
+
+        if(i == noSlot)
+        {
+            i = slots.size();
+            slots.emplace_back(mPtr);
+            slotUses.emplace_back(0);
+            slotInfos.push_back({mId});
+
+            const auto& slot(
+                slotIndices.try_emplace(AssetId{mId}.getHash(), i));
+
+            if(!slot.second)
+            {
+                ssvu::lo("ssvs::ResourceHolder")
+                    << "asset id hash collision between " << mId << " and "
+                    << slotInfos[slot.first->second].id
+                    << ", handles from `AssetId` refer to the latter\n";
+
+                collidedSlots.emplace(mId, i);
+            }
+        }
+        else
+        {
+            slots[i] = mPtr;
+            slotInfos[i].placeholder = false;
+
+            // The replaced resource is kept alive, but no longer mapped.
+            if(auto& owner(slotInfos[i].owner); owner != noSlot)
+            {
+                ownerSlots[owner] = noSlot;
+                owner = noSlot;
+            }
+        }
+
+        setSlotBytes(i, isOwned(mPtr) ? getResourceBytes(*mPtr) : 0);
+        return i;
+    }
+
+    std::size_t emplace(const std::string& mId, T* mPtr)
+    {
+        const auto& inserted(resources.insert_or_assign(mId, mPtr));
+        return emplaceSlot(inserted.first->first, mPtr);
+    }
 
     auto& emplaceAndGet(const std::string& mId, T* mPtr)
     {
-        const auto& inserted(resources.emplace(mId, mPtr));
-        return *inserted.first->second;
+        return *slots[emplace(mId, mPtr)];
+    }
+
+    auto& emplaceOwned(const std::string& mId, std::unique_ptr<T> mPtr)
+    {
+        auto& result(*mPtr);
+        const auto i(emplace(mId, &result));
+
+        slotInfos[i].owner = ownership.size();
+        ownership.emplace_back(std::move(mPtr));
+        ownerSlots.emplace_back(i);
+
+        return result;
+    }
+
+    // Frees the resource owned through slot `mI`, if any. The last owned
+    // one takes its place, so that this takes constant time.
+    void disown(std::size_t mI) noexcept
+    {
+        auto& owner(slotInfos[mI].owner);
+        if(owner == noSlot) return;
+
+        if(owner != ownership.size() - 1)
+        {
+            const auto moved(ownerSlots.back());
+            ownership[owner] = std::move(ownership.back());
+            ownerSlots[owner] = moved;
+
+            if(moved != noSlot) slotInfos[moved].owner = owner;
+        }
+
+        ownership.pop_back();
+        ownerSlots.pop_back();
+        owner = noSlot;
+    }
+
+    [[nodiscard]] T* find(std::string_view mId) const
+    {
+        const auto itr(resources.find(mId));
+        if(itr != resources.end()) [[likely]]
+            return itr->second;
+
+        const auto lazyItr(lazy.find(mId));
+        if(lazyItr != lazy.end() && slots[lazyItr->second.slot] != nullptr)
+            return slots[lazyItr->second.slot];
+
+        return policy.getMissing(*this, mId);
+    }
+
+    T* loadLazy(std::string_view mId, LazyEntry& mEntry)
+    {
+        slotUses[mEntry.slot] = useClock;
+
+        auto& slot(slots[mEntry.slot]);
+        if(slot != nullptr) return slot;
+
+        auto ptr(Loader<T>::load(mEntry.path));
+
+        if(ptr == nullptr)
+        {
+            // Not retried: the slot keeps the missing resource.
+            mEntry.failed = true;
+            slot = policy.getMissing(*this, mId);
+            return slot;
+        }
+
+        mEntry.bytes = getResourceBytes(*ptr) + getSourceBytes(mEntry.path);
+        lazyBytes += mEntry.bytes;
+        setSlotBytes(mEntry.slot, mEntry.bytes);
+
+        slot = ptr.get();
+        mEntry.resource = std::move(ptr);
+        return slot;
+    }
+
+    void evict(LazyEntry& mEntry) noexcept
+    {
+        lazyBytes -= mEntry.bytes;
+        mEntry.bytes = 0;
+        mEntry.resource.reset();
+        slots[mEntry.slot] = nullptr;
+        setSlotBytes(mEntry.slot, 0);
+    }
+
+    [[nodiscard]] AssetHandle<T> makeHandle(std::size_t mI) const noexcept
+    {
+        return AssetHandle<T>{
+            slotInfos[mI].lazyEntry == nullptr ? mI : mI | lazyBit};
+    }
+
+    // Resolves the handles the fast path of `operator[]` does not: lazy,
+    // invalid and unloaded ones.
+    T* resolve(std::size_t mIndex)
+    {
+        const auto i(mIndex & ~lazyBit);
+        if(i >= slots.size()) return policy.getMissing(*this, {});
+
+        if constexpr(isLoadableFromPath<T>)
+            if(auto* e(slotInfos[i].lazyEntry); e != nullptr)
+                return loadLazy(slotInfos[i].id, *e);
+
+        if(slots[i] != nullptr) return slots[i];
+        return policy.getMissing(*this, slotInfos[i].id);
+    }
+
+    [[nodiscard]] SlotInfo& getSlotInfo(std::string_view mId)
+    {
+        const auto i(findSlot(mId));
+        assert(i != noSlot);
+
+        return slotInfos[i];
+    }
+
+    T* findOrLoad(std::string_view mId)
+    {
+        const auto itr(resources.find(mId));
+        if(itr != resources.end()) [[likely]]
+            return itr->second;
+
+        if constexpr(isLoadableFromPath<T>)
+        {
+            const auto lazyItr(lazy.find(mId));
+            if(lazyItr != lazy.end())
+                return loadLazy(lazyItr->first, lazyItr->second);
+        }
+
+        return policy.getMissing(*this, mId);
     }
 
 public:
+    /// @brief Returns true if `mId` is not mapped, or only to the null
+    /// asset: by a handle resolved before loading it, or by a failed load.
+    /// `load` and `adopt` replace such a mapping.
+    [[nodiscard]] bool canLoad(std::string_view mId) const
+    {
+        const auto itr(resources.find(mId));
+        if(itr == resources.end()) return !lazy.contains(mId);
+
+        if(itr->second != DefResHelper<T>::get()) return false;
+        return !slotInfos[findSlot(mId)].placeholder;
+    }
+
     template <typename... TArgs>
     T& load(const std::string& mId, TArgs&&... mArgs)
     {
+        assert(canLoad(mId));
+
+        const auto sourceBytes(getSourceBytes(mArgs...));
+        auto& result(policy.load(*this, mId, FWD(mArgs)...));
+
+        if(sourceBytes > 0 && isOwned(&result))
+        {
+            const auto i(findSlot(mId));
+            setSlotBytes(i, slotInfos[i].bytes + sourceBytes);
+        }
+
+        return result;
+    }
+
+    /// @brief Takes ownership of an already loaded resource. A null
+    /// `mPtr` is handled like a failed load.
+    /// @details Replaces the resource `mId` is mapped to, if any: handles to
+    /// `mId` then refer to the adopted one. The replaced resource is kept
+    /// alive.
+    T& adopt(const std::string& mId, std::unique_ptr<T> mPtr)
+    {
+        assert(!lazy.contains(mId));
+        return policy.adopt(*this, mId, std::move(mPtr));
+    }
+
+    /// @brief Maps `mId` to the file at `mPath` without loading it. It is
+    /// loaded by the first non-const lookup, through its id or a handle.
+    void registerLazy(const std::string& mId, const ssvufs::Path& mPath)
+    {
+        static_assert(isLoadableFromPath<T>,
+            "This resource type cannot be loaded from a path alone");
+
         assert(!has(mId));
-        return policy.load(*this, mId, FWD(mArgs)...);
+
+        const auto& inserted(lazy.try_emplace(mId, LazyEntry{mPath, {}, 0}));
+        auto& entry(inserted.first->second);
+
+        entry.slot = emplaceSlot(inserted.first->first, nullptr);
+        slotInfos[entry.slot].lazyEntry = &entry;
     }
 
-    const T& operator[](const std::string& mId) const
+    /// @brief Sets the memory lazily loaded resources may take before
+    /// `trimLazy` evicts some.
+    void setLazyBudget(std::size_t mBytes) noexcept
     {
-        policy.checkMissing(*this, mId);
-        return *resources.at(mId);
+        lazyBudget = mBytes;
+    }
+
+    [[nodiscard]] std::size_t getLazyBudget() const noexcept
+    {
+        return lazyBudget;
+    }
+
+    /// @brief Returns the estimated memory held by the lazily loaded
+    /// resources.
+    [[nodiscard]] std::size_t getLazyBytes() const noexcept
+    {
+        return lazyBytes;
+    }
+
+    /// @brief Evicts the least recently used lazy resources until their
+    /// memory fits in the budget. Evicted ones are loaded again by the next
+    /// lookup. Returns the number of evicted resources.
+    /// @details Recency is measured in calls to this function, which is
+    /// meant to run once per frame, where no reference to the resources is
+    /// held: references to evicted ones dangle. Sounds still playing an
+    /// evicted buffer must be stopped first.
+    std::size_t trimLazy()
+    {
+        ++useClock;
+        if(lazyBytes <= lazyBudget) return 0;
+
+        std::vector<LazyEntry*> loaded;
+        for(auto& [id, e] : lazy)
+            if(e.resource != nullptr) loaded.emplace_back(&e);
+
+        std::sort(loaded.begin(), loaded.end(),
+            [this](const LazyEntry* mA, const LazyEntry* mB) {
+                return slotUses[mA->slot] < slotUses[mB->slot];
+            });
+
+        std::size_t result{0};
+
+        for(auto* e : loaded)
+        {
+            if(lazyBytes <= lazyBudget) break;
+
+            evict(*e);
+            ++result;
+        }
+
+        return result;
+    }
+
+    /// @brief Frees the resource mapped to `mId`, which must not have a
+    /// pending asynchronous load. Lazy resources are evicted and stay
+    /// registered; others are unmapped, and can be loaded again.
+    /// @details Handles to `mId` stay valid, and resolve like a missing id
+    /// until it is loaded again. Returns false if `mId` was not mapped, or
+    /// is a lazy resource that is not loaded.
+    bool unload(std::string_view mId)
+    {
+        if(const auto itr(lazy.find(mId)); itr != lazy.end())
+        {
+            if(itr->second.resource == nullptr) return false;
+
+            evict(itr->second);
+            return true;
+        }
+
+        const auto itr(resources.find(mId));
+        if(itr == resources.end()) return false;
+
+        const auto i(findSlot(mId));
+        slots[i] = nullptr;
+        setSlotBytes(i, 0);
+        disown(i);
+
+        resources.erase(itr);
+        return true;
+    }
+
+    /// @brief Counts a reference to `mId` from an asset group. If
+    /// `mUnloadable`, the group loaded it, and releasing the last reference
+    /// unloads it.
+    void retain(std::string_view mId, bool mUnloadable)
+    {
+        auto& info(getSlotInfo(mId));
+        ++info.refs;
+        info.unloadable = info.unloadable || mUnloadable;
+    }
+
+    /// @brief Releases a reference counted by `retain`. Returns true if the
+    /// resource was unloaded, and false for ids this holder does not know.
+    bool release(std::string_view mId)
+    {
+        const auto i(findSlot(mId));
+        if(i == noSlot) return false;
+
+        auto& info(slotInfos[i]);
+        assert(info.refs > 0);
+
+        if(--info.refs > 0 || !info.unloadable) return false;
+
+        info.unloadable = false;
+        return unload(mId);
+    }
+
+    [[nodiscard]] std::size_t getRefCount(std::string_view mId) const
+    {
+        const auto i(findSlot(mId));
+        return i == noSlot ? 0 : slotInfos[i].refs;
+    }
+
+    /// @brief Returns true if `mId` is mapped and its resource is in memory.
+    /// Lazy resources count only while loaded.
+    [[nodiscard]] bool isLoaded(std::string_view mId) const
+    {
+        const auto itr(lazy.find(mId));
+        if(itr == lazy.end()) return resources.contains(mId);
+
+        return itr->second.resource != nullptr;
+    }
+
+    /// @brief Maps `mId` to a resource owned elsewhere, such as a null
+    /// asset, until `adopt` replaces it.
+    void setPlaceholder(const std::string& mId, T* mPtr)
+    {
+        assert(canLoad(mId));
+
+        emplaceAndGet(mId, mPtr);
+        getSlotInfo(mId).placeholder = true;
     }
 
-    T& operator[](const std::string& mId)
+    /// @brief Returns a handle to the resource mapped to `mId`, applying
+    /// the missing resource policy first.
+    [[nodiscard]] AssetHandle<T> getHandle(std::string_view mId)
     {
         policy.checkMissing(*this, mId);
-        return *resources[mId];
+
+        const auto i(findSlot(mId));
+        return i == noSlot ? AssetHandle<T>{} : makeHandle(i);
+    }
+
+    /// @brief Returns a handle to the resource mapped to the id hashed into
+    /// `mId`, or an invalid handle if there is none. If several ids share
+    /// the hash, refers to the first one mapped.
+    [[nodiscard]] AssetHandle<T> getHandle(AssetId mId) const
+    {
+        const auto itr(slotIndices.find(mId.getHash()));
+        if(itr == slotIndices.end()) return {};
+
+        return makeHandle(itr->second);
+    }
+
+    /// @brief Returns the resource `mHandle` refers to. Invalid handles
+    /// resolve like a missing id, in every build.
+    [[nodiscard]] T& operator[](AssetHandle<T> mHandle)
+    {
+        const auto i(mHandle.getIndex());
+        if(i < slots.size() && slots[i] != nullptr) [[likely]]
+            return *slots[i];
+
+        return *resolve(i);
+    }
+
+    /// @brief Returns the resource mapped to `mId`, or the one chosen by
+    /// the missing resource policy. Never allocates nor maps `mId`, and
+    /// only finds lazy resources that are already loaded.
+    [[nodiscard]] const T& operator[](std::string_view mId) const
+    {
+        return *find(mId);
+    }
+
+    /// @brief Like the const overload, but loads lazy resources.
+    [[nodiscard]] T& operator[](std::string_view mId)
+    {
+        return *findOrLoad(mId);
+    }
+
+    /// @brief Returns true if `mId` is mapped, even to a lazy resource that
+    /// is not loaded.
+    [[nodiscard]] bool has(std::string_view mId) const noexcept
+    {
+        return resources.contains(mId) || lazy.contains(mId);
+    }
+
+    /// @brief Also accounts for the memory of this holder in `mMemory`,
+    /// which must outlive it.
+    void setSharedMemory(MemoryCounter& mMemory) noexcept
+    {
+        assert(sharedMemory == nullptr);
+
+        sharedMemory = &mMemory;
+        sharedMemory->add(memory.bytes);
+    }
+
+    [[nodiscard]] const MemoryCounter& getMemory() const noexcept
+    {
+        return memory;
     }
 
-    bool has(const std::string& mId) const noexcept
+    void resetMemoryPeak() noexcept
     {
-        return resources.count(mId) > 0;
+        memory.resetPeak();
     }
 
+    /// @brief Calls `mF(id, bytes)` for each resource in memory, skipping
+    /// null assets, placeholders and lazy resources that are not loaded.
+    template <typename TF>
+    void forEachLoaded(TF&& mF) const
+    {
+        for(std::size_t i{0}; i < slots.size(); ++i)
+            if(isOwned(slots[i])) mF(slotInfos[i].id, slotInfos[i].bytes);
+    }
+
+    /// @brief Returns the resources that are not lazy.
     auto& getResources() noexcept
     {
         return resources;
     }
+
+    const auto& getResources() const noexcept
+    {
+        return resources;
+    }
 };
 
 } // namespace ssvs::Impl
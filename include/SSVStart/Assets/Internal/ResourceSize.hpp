@@ -0,0 +1,145 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include <SSVUtils/Core/FileSystem/Path.hpp>
+
+#include <SFML/Audio/Music.hpp>
+#include <SFML/Audio/SoundBuffer.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Shader.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/InputStream.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string_view>
+#include <system_error>
+
+namespace ssvs
+{
+
+class BitmapFont;
+class Tileset;
+
+namespace Impl
+{
+    /// @brief Returns the number of source bytes a load will read, or zero
+    /// if unknown.
+    [[nodiscard]] inline std::uintmax_t getSourceSize(
+        const ssvufs::Path& mPath)
+    {
+        std::error_code ec;
+        const auto result(std::filesystem::file_size(mPath.getStr(), ec));
+        return ec ? 0 : result;
+    }
+
+    [[nodiscard]] inline std::uintmax_t getSourceSize(
+        const void*, std::size_t mSize) noexcept
+    {
+        return mSize;
+    }
+
+    [[nodiscard]] inline std::uintmax_t getSourceSize(sf::InputStream& mStream)
+    {
+        return static_cast<std::uintmax_t>(std::max<sf::Int64>(
+            mStream.getSize(), 0));
+    }
+
+    // Estimates of the memory held by a resource, in bytes. Textures are
+    // counted as RGBA8, the format SFML uploads them in.
+
+    [[nodiscard]] inline std::size_t getResourceBytes(const sf::Image& mX)
+    {
+        const auto size(mX.getSize());
+        return std::size_t(size.x) * size.y * 4;
+    }
+
+    [[nodiscard]] inline std::size_t getResourceBytes(const sf::Texture& mX)
+    {
+        const auto size(mX.getSize());
+        return std::size_t(size.x) * size.y * 4;
+    }
+
+    [[nodiscard]] inline std::size_t getResourceBytes(
+        const sf::SoundBuffer& mX)
+    {
+        return static_cast<std::size_t>(mX.getSampleCount()) *
+               sizeof(sf::Int16);
+    }
+
+    /// @brief Music is streamed through a buffer of one second of samples.
+    [[nodiscard]] inline std::size_t getResourceBytes(const sf::Music& mX)
+    {
+        return std::size_t(mX.getSampleRate()) * mX.getChannelCount() *
+               sizeof(sf::Int16);
+    }
+
+    /// @brief Fallback for the types whose memory cannot be measured from
+    /// the resource. The face data of fonts is accounted for as the size
+    /// of their source instead.
+    template <typename T>
+    [[nodiscard]] std::size_t getResourceBytes(const T&) noexcept
+    {
+        return 0;
+    }
+
+    template <typename T>
+    inline constexpr std::string_view resourceTypeName{"unknown"};
+
+    template <>
+    inline constexpr std::string_view resourceTypeName<sf::Font>{"Font"};
+
+    template <>
+    inline constexpr std::string_view resourceTypeName<sf::Image>{"Image"};
+
+    template <>
+    inline constexpr std::string_view resourceTypeName<sf::Texture>{
+        "Texture"};
+
+    template <>
+    inline constexpr std::string_view resourceTypeName<sf::SoundBuffer>{
+        "SoundBuffer"};
+
+    template <>
+    inline constexpr std::string_view resourceTypeName<sf::Music>{"Music"};
+
+    template <>
+    inline constexpr std::string_view resourceTypeName<sf::Shader>{"Shader"};
+
+    template <>
+    inline constexpr std::string_view resourceTypeName<BitmapFont>{
+        "BitmapFont"};
+
+    template <>
+    inline constexpr std::string_view resourceTypeName<Tileset>{"Tileset"};
+
+    /// @brief Running byte count with its high-water mark.
+    struct MemoryCounter
+    {
+        std::size_t bytes{0}, peakBytes{0};
+
+        void add(std::size_t mBytes) noexcept
+        {
+            bytes += mBytes;
+            peakBytes = std::max(peakBytes, bytes);
+        }
+
+        void remove(std::size_t mBytes) noexcept
+        {
+            bytes -= mBytes;
+        }
+
+        void resetPeak() noexcept
+        {
+            peakBytes = bytes;
+        }
+    };
+} // namespace Impl
+
+} // namespace ssvs
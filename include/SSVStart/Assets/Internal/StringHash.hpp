@@ -0,0 +1,32 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace ssvs::Impl
+{
+
+/// @brief Transparent hash letting string-keyed maps be searched with a
+/// `std::string_view` or a literal, without constructing a `std::string`.
+struct StringHash
+{
+    using is_transparent = void;
+
+    [[nodiscard]] std::size_t operator()(std::string_view mStr) const noexcept
+    {
+        return std::hash<std::string_view>{}(mStr);
+    }
+};
+
+template <typename T>
+using StringMap =
+    std::unordered_map<std::string, T, StringHash, std::equal_to<>>;
+
+} // namespace ssvs::Impl
@@ -0,0 +1,368 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include "SSVStart/Global/Typedefs.hpp"
+#include "SSVStart/Global/Trace.hpp"
+#include "SSVStart/Assets/Internal/DefaultAssets.hpp"
+#include "SSVStart/Assets/Internal/StringHash.hpp"
+
+#include <SSVUtils/Core/Log/Log.hpp>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ssvs
+{
+
+namespace Impl
+{
+    /// @brief Packs rectangles into a fixed-size area with the skyline
+    /// bottom-left heuristic.
+    class SkylinePacker
+    {
+    private:
+        struct Node
+        {
+            unsigned int x, y, width;
+        };
+
+        Vec2u size;
+        std::vector<Node> skyline;
+        unsigned int usedHeight{0};
+
+        // Returns the lowest `y` at which a `mWidth` x `mHeight` rectangle
+        // can rest on the skyline starting at node `mI`.
+        [[nodiscard]] std::optional<unsigned int> getFit(std::size_t mI,
+            unsigned int mWidth, unsigned int mHeight) const noexcept
+        {
+            if(skyline[mI].x + mWidth > size.x) return std::nullopt;
+
+            unsigned int y{0}, left{mWidth};
+
+            for(auto i(mI); left > 0; ++i)
+            {
+                y = std::max(y, skyline[i].y);
+                if(y + mHeight > size.y) return std::nullopt;
+
+                left -= std::min(left, skyline[i].width);
+            }
+
+            return y;
+        }
+
+        void addNode(std::size_t mI, const Node& mNode)
+        {
+            skyline.insert(skyline.begin() + mI, mNode);
+
+            // Shrink or remove the nodes now covered by the new one.
+            for(auto i(mI + 1); i < skyline.size();)
+            {
+                const auto& prev(skyline[i - 1]);
+                const auto prevEnd(prev.x + prev.width);
+                if(skyline[i].x >= prevEnd) break;
+
+                const auto shrink(prevEnd - skyline[i].x);
+                if(skyline[i].width > shrink)
+                {
+                    skyline[i].x += shrink;
+                    skyline[i].width -= shrink;
+                    break;
+                }
+
+                skyline.erase(skyline.begin() + i);
+            }
+
+            // Merge neighbours at the same height.
+            for(std::size_t i{0}; i + 1 < skyline.size();)
+            {
+                if(skyline[i].y != skyline[i + 1].y)
+                {
+                    ++i;
+                    continue;
+                }
+
+                skyline[i].width += skyline[i + 1].width;
+                skyline.erase(skyline.begin() + i + 1);
+            }
+        }
+
+    public:
+        SkylinePacker(const Vec2u& mSize)
+            : size{mSize}, skyline{{0, 0, mSize.x}}
+        {
+        }
+
+        /// @brief Returns the top-left corner of the placed rectangle, or
+        /// nothing if it does not fit.
+        [[nodiscard]] std::optional<Vec2u> insert(
+            unsigned int mWidth, unsigned int mHeight)
+        {
+            if(mWidth == 0 || mHeight == 0) return std::nullopt;
+
+            auto bestI(skyline.size());
+            auto bestBottom(std::numeric_limits<unsigned int>::max());
+            auto bestWidth(std::numeric_limits<unsigned int>::max());
+            unsigned int bestY{0};
+
+            for(std::size_t i{0}; i < skyline.size(); ++i)
+            {
+                const auto y(getFit(i, mWidth, mHeight));
+                if(!y) continue;
+
+                const auto bottom(*y + mHeight);
+                if(bottom < bestBottom ||
+                    (bottom == bestBottom && skyline[i].width < bestWidth))
+                {
+                    bestI = i;
+                    bestBottom = bottom;
+                    bestWidth = skyline[i].width;
+                    bestY = *y;
+                }
+            }
+
+            if(bestI == skyline.size()) return std::nullopt;
+
+            const Vec2u result{skyline[bestI].x, bestY};
+            addNode(bestI, {result.x, bestBottom, mWidth});
+            usedHeight = std::max(usedHeight, bestBottom);
+
+            return result;
+        }
+
+        [[nodiscard]] const Vec2u& getSize() const noexcept
+        {
+            return size;
+        }
+
+        /// @brief Returns the height of the area covered so far.
+        [[nodiscard]] unsigned int getUsedHeight() const noexcept
+        {
+            return usedHeight;
+        }
+    };
+} // namespace Impl
+
+/// @brief Part of an atlas page holding one of the packed images.
+struct AtlasRegion
+{
+    const sf::Texture* texture;
+    sf::IntRect rect;
+};
+
+/// @brief Packs many small images into a few large textures, so that
+/// sprites using them can be drawn with the same texture bound.
+/// @details Images are collected with `add` or `addFromManager`, and packed
+/// by `build`, which must run on the thread owning the GL context. Each
+/// image is then found under its original id as a page and a rectangle.
+class TextureAtlas
+{
+private:
+    struct Source
+    {
+        std::string id;
+        const sf::Image* image;
+    };
+
+    Vec2u pageSize;
+    unsigned int padding;
+    std::vector<Source> sources;
+    std::vector<std::unique_ptr<sf::Texture>> pages;
+    Impl::StringMap<AtlasRegion> regions;
+
+    [[nodiscard]] bool fitsInPage(const Vec2u& mSize) const noexcept
+    {
+        return mSize.x > 0 && mSize.y > 0 &&
+               mSize.x + padding <= pageSize.x &&
+               mSize.y + padding <= pageSize.y;
+    }
+
+public:
+    /// @param mPadding Transparent pixels left between images, to avoid
+    /// bleeding when the pages are drawn with smoothing or scaled.
+    explicit TextureAtlas(
+        const Vec2u& mPageSize = {2048, 2048}, unsigned int mPadding = 1)
+        : pageSize{mPageSize}, padding{mPadding}
+    {
+    }
+
+    TextureAtlas(const TextureAtlas&) = delete;
+    TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+    /// @brief Queues `mImage` for the next `build`. It must stay alive
+    /// until then. Returns false if it is empty or larger than a page.
+    bool add(const std::string& mId, const sf::Image& mImage)
+    {
+        assert(!has(mId));
+
+        if(!fitsInPage(mImage.getSize())) return false;
+
+        sources.push_back({mId, &mImage});
+        return true;
+    }
+
+    /// @brief Queues every image of `mMgr` that fits in a page, except
+    /// those mapped to the null asset. Returns how many were queued.
+    template <typename TM>
+    std::size_t addFromManager(TM& mMgr)
+    {
+        const auto* nullImage(Impl::DefResHelper<sf::Image>::get());
+        std::size_t result{0};
+
+        for(const auto& [id, ptr] : mMgr.template getAll<sf::Image>())
+            if(ptr != nullptr && ptr != nullImage && add(id, *ptr)) ++result;
+
+        return result;
+    }
+
+    /// @brief Packs the queued images into new pages and uploads them.
+    /// Returns false if a page texture could not be created, in which case
+    /// its images are not registered.
+    bool build()
+    {
+        SSVS_PROFILE_SCOPE("TextureAtlas::build");
+
+        // Placing tall images first packs the skyline more tightly.
+        std::sort(sources.begin(), sources.end(),
+            [](const Source& mA, const Source& mB) {
+                const auto& a(mA.image->getSize());
+                const auto& b(mB.image->getSize());
+                return a.y != b.y ? a.y > b.y : a.x > b.x;
+            });
+
+        struct Placement
+        {
+            const Source* source;
+            std::size_t page;
+            Vec2u position;
+        };
+
+        std::vector<Impl::SkylinePacker> packers;
+        std::vector<Placement> placements;
+        placements.reserve(sources.size());
+
+        for(const auto& s : sources)
+        {
+            const auto& size(s.image->getSize());
+            const auto w(size.x + padding), h(size.y + padding);
+
+            std::optional<Vec2u> position;
+            std::size_t page{0};
+
+            for(; page < packers.size(); ++page)
+                if((position = packers[page].insert(w, h))) break;
+
+            // `add` made sure it fits in an empty page.
+            if(!position)
+                position = packers.emplace_back(pageSize).insert(w, h);
+
+            assert(position);
+            placements.push_back({&s, page, *position});
+        }
+
+        bool ok{true};
+        const auto firstPage(pages.size());
+
+        for(std::size_t i{0}; i < packers.size(); ++i)
+        {
+            sf::Image pageImage;
+            pageImage.create(
+                pageSize.x, packers[i].getUsedHeight(), sf::Color::Transparent);
+
+            for(const auto& p : placements)
+                if(p.page == i)
+                    pageImage.copy(
+                        *p.source->image, p.position.x, p.position.y);
+
+            auto texture(std::make_unique<sf::Texture>());
+            if(!texture->loadFromImage(pageImage))
+            {
+                ssvu::lo("ssvs::TextureAtlas::build")
+                    << "Failed to create page " << i << "\n";
+
+                ok = false;
+                texture.reset();
+            }
+
+            pages.emplace_back(std::move(texture));
+        }
+
+        for(const auto& p : placements)
+        {
+            const auto* texture(pages[firstPage + p.page].get());
+            if(texture == nullptr) continue;
+
+            const auto& size(p.source->image->getSize());
+            regions.insert_or_assign(p.source->id,
+                AtlasRegion{texture,
+                    {int(p.position.x), int(p.position.y), int(size.x),
+                        int(size.y)}});
+        }
+
+        // Failed pages are not kept, so that every page is usable.
+        pages.erase(std::remove(pages.begin() + firstPage, pages.end(),
+                        nullptr),
+            pages.end());
+
+        sources.clear();
+        return ok;
+    }
+
+    [[nodiscard]] bool has(std::string_view mId) const noexcept
+    {
+        return regions.contains(mId);
+    }
+
+    /// @brief Returns the region of the image packed under `mId`, or null
+    /// if there is none.
+    [[nodiscard]] const AtlasRegion* find(std::string_view mId) const
+    {
+        const auto itr(regions.find(mId));
+        return itr == regions.end() ? nullptr : &itr->second;
+    }
+
+    [[nodiscard]] const AtlasRegion& operator[](std::string_view mId) const
+    {
+        const auto* result(find(mId));
+        assert(result != nullptr);
+
+        return *result;
+    }
+
+    [[nodiscard]] std::size_t getPageCount() const noexcept
+    {
+        return pages.size();
+    }
+
+    [[nodiscard]] const sf::Texture& getPage(std::size_t mIdx) const noexcept
+    {
+        assert(mIdx < pages.size());
+        return *pages[mIdx];
+    }
+
+    [[nodiscard]] const Vec2u& getPageSize() const noexcept
+    {
+        return pageSize;
+    }
+
+    [[nodiscard]] const auto& getRegions() const noexcept
+    {
+        return regions;
+    }
+};
+
+} // namespace ssvs
@@ -6,6 +6,7 @@
 #define SSVS_BITMAPTEXT_BTR_IMPL_BTRROOT
 
 #include "SSVStart/Global/Typedefs.hpp"
+#include "SSVStart/Global/Trace.hpp"
 #include "SSVStart/BitmapText/Impl/BitmapFont.hpp"
 
 #include "SSVStart/BitmapText/BTR/Impl/BTREffect.hpp"
@@ -50,6 +51,8 @@ namespace ssvs
 
                 inline void refreshIfNeeded() const
                 {
+                    SSVS_PROFILE_SCOPE("BTRRoot::refreshIfNeeded");
+
                     refreshGeometryIfNeeded();
                     baseChunk->refreshEffects();
                 }
@@ -234,6 +237,22 @@ namespace ssvs
                     mRenderTarget.draw(vertices, mRenderStates);
                 }
 
+                /// @brief Records the text as vertices into `mList`, e.g. a
+                /// `DrawList`, so that it can be submitted from another
+                /// thread.
+                template <typename TList>
+                inline void recordTo(
+                    TList& mList, sf::RenderStates mRenderStates) const
+                {
+                    assert(bitmapFont != nullptr && texture != nullptr);
+
+                    refreshIfNeeded();
+
+                    mRenderStates.texture = texture;
+                    mRenderStates.transform *= getTransform();
+                    mList.add(vertices, mRenderStates);
+                }
+
                 inline auto& getRoot() noexcept { return *baseChunk; }
                 inline auto& getLast() noexcept { return *lastChunk; }
                 inline const auto& getRoot() const noexcept
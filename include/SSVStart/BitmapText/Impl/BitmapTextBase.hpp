@@ -5,6 +5,7 @@
 #pragma once
 
 #include "SSVStart/Global/Typedefs.hpp"
+#include "SSVStart/Global/Trace.hpp"
 #include "SSVStart/VertexVector/VertexVector.hpp"
 #include "SSVStart/BitmapText/Impl/BitmapFont.hpp"
 #include "SSVStart/BitmapText/Impl/BitmapTextDrawState.hpp"
@@ -69,6 +70,8 @@ protected:
 
     void createVertices(const std::string& mStr) const
     {
+        SSVS_PROFILE_SCOPE("BitmapTextBase::createVertices");
+
         vertices.reserve(mStr.size() * 4);
 
         for(const auto& c : mStr)
@@ -160,6 +163,20 @@ public:
         mRenderTarget.draw(vertices, mRenderStates);
     }
 
+    /// @brief Records the text as vertices into `mList`, e.g. a `DrawList`,
+    /// so that it can be submitted from another thread.
+    template <typename TList>
+    void recordTo(TList& mList, sf::RenderStates mRenderStates) const
+    {
+        assert(bitmapFont != nullptr && texture != nullptr);
+
+        getTD().refreshIfNeeded();
+
+        mRenderStates.texture = texture;
+        mRenderStates.transform *= getTransform();
+        mList.add(vertices, mRenderStates);
+    }
+
     const auto& getBitmapFont() const noexcept
     {
         return bitmapFont;
@@ -13,12 +13,13 @@
 namespace ssvs
 {
 
-class GameWindow;
-
-class Camera
+/// @brief View that can be panned, zoomed and rotated over time, applied to
+/// a game window of type `TWindow`, e.g. `BasicGameWindow<TimerStatic>`.
+template <typename TWindow = GameWindow>
+class BasicCamera
 {
 private:
-    GameWindow& gameWindow;
+    TWindow& gameWindow;
     sf::RenderWindow& renderWindow;
     sf::View view, computedView;
     Vec2f nextPan, offset, skew{1.f, 1.f};
@@ -26,13 +27,13 @@ private:
     bool invalid{true}, mustRecompute{true};
 
 public:
-    Camera(GameWindow& mGameWindow, const sf::View& mView)
+    BasicCamera(TWindow& mGameWindow, const sf::View& mView)
         : gameWindow(mGameWindow), renderWindow(gameWindow), view{mView}
     {
     }
 
-    Camera(
-        GameWindow& mGameWindow, const Vec2f& mCenter, float mZoomFactor = 1.f)
+    BasicCamera(
+        TWindow& mGameWindow, const Vec2f& mCenter, float mZoomFactor = 1.f)
         : gameWindow(mGameWindow),
           renderWindow(gameWindow), view{mCenter,
                                         {gameWindow.getWidth() / mZoomFactor,
@@ -42,7 +43,7 @@ public:
         assert(mZoomFactor != 0);
     }
 
-    Camera(GameWindow& mGameWindow, float mZoomFactor = 1.f)
+    BasicCamera(TWindow& mGameWindow, float mZoomFactor = 1.f)
         : gameWindow(mGameWindow), renderWindow(gameWindow),
           view{{gameWindow.getWidth() / 2.f / mZoomFactor,
                    gameWindow.getHeight() / 2.f / mZoomFactor},
@@ -70,11 +71,12 @@ public:
             mustRecompute = false;
         }
 
-        renderWindow.setView(computedView);
+        // Through the game window, so that it is recorded when pipelined.
+        gameWindow.setView(computedView);
     }
     void unapply()
     {
-        renderWindow.setView(renderWindow.getDefaultView());
+        gameWindow.setView(gameWindow.getDefaultView());
     }
 
     // These methods change the view ON NEXT UPDATE
@@ -198,4 +200,6 @@ public:
     }
 };
 
+using Camera = BasicCamera<>;
+
 } // namespace ssvs
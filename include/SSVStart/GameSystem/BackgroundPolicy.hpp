@@ -0,0 +1,111 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include "SSVStart/Global/Typedefs.hpp"
+
+#include <SFML/Window/Event.hpp>
+
+#include <algorithm>
+
+namespace ssvs
+{
+
+enum class BackgroundMode
+{
+    /// @brief Keep running as if focused.
+    Full,
+
+    /// @brief Keep simulating at a reduced frame rate.
+    Throttled,
+
+    /// @brief Block until the window regains focus.
+    Paused
+};
+
+/// @brief How `GameWindow` and `GameHeadless` behave while they do not have
+/// focus.
+struct BackgroundPolicy
+{
+    BackgroundMode mode{BackgroundMode::Full};
+
+    /// @brief Frame rate used in `Throttled` mode.
+    float fps{10.f};
+
+    /// @brief Maximum frame time fed to the timer in `Throttled` mode. The
+    /// default of one tick makes the simulation run at `fps` ticks per
+    /// second instead of catching up with real time. Zero disables the cap.
+    FT maxFrameTime{1.f};
+
+    /// @brief Skips drawing and presenting in `Throttled` mode.
+    bool skipDraw{true};
+};
+
+/// @brief Tracks focus from the window's events and applies a
+/// `BackgroundPolicy` to the frames run without it.
+class BackgroundController
+{
+private:
+    BackgroundPolicy policy;
+    bool focus{true};
+
+public:
+    /// @brief Updates the focus from `mEvent`. Returns true if it gave the
+    /// focus back.
+    bool handleEvent(const sf::Event& mEvent) noexcept
+    {
+        if(mEvent.type == sf::Event::LostFocus)
+        {
+            focus = false;
+        }
+        else if(mEvent.type == sf::Event::GainedFocus && !focus)
+        {
+            focus = true;
+            return true;
+        }
+
+        return false;
+    }
+
+    void setPolicy(const BackgroundPolicy& mPolicy) noexcept
+    {
+        policy = mPolicy;
+    }
+
+    [[nodiscard]] const BackgroundPolicy& getPolicy() const noexcept
+    {
+        return policy;
+    }
+
+    [[nodiscard]] bool hasFocus() const noexcept
+    {
+        return focus;
+    }
+
+    /// @brief Returns whether frames must wait for the focus to return.
+    [[nodiscard]] bool isPaused() const noexcept
+    {
+        return !focus && policy.mode == BackgroundMode::Paused;
+    }
+
+    [[nodiscard]] bool isThrottled() const noexcept
+    {
+        return !focus && policy.mode == BackgroundMode::Throttled;
+    }
+
+    [[nodiscard]] bool isDrawing() const noexcept
+    {
+        return !isThrottled() || !policy.skipDraw;
+    }
+
+    /// @brief Returns `mFrameTime` capped as the policy requires.
+    [[nodiscard]] FT getFrameTime(FT mFrameTime) const noexcept
+    {
+        if(!isThrottled() || policy.maxFrameTime <= 0) return mFrameTime;
+        return std::min(mFrameTime, policy.maxFrameTime);
+    }
+};
+
+} // namespace ssvs
@@ -0,0 +1,209 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include "SSVStart/VertexVector/VertexVector.hpp"
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ssvs
+{
+
+class DrawList;
+
+namespace Impl
+{
+    template <typename T, typename = void>
+    inline constexpr bool hasRecordTo{false};
+
+    template <typename T>
+    inline constexpr bool hasRecordTo<T,
+        std::void_t<decltype(std::declval<const T&>().recordTo(
+            std::declval<DrawList&>(), std::declval<sf::RenderStates>()))>>{
+        true};
+} // namespace Impl
+
+/// @brief Whether `T` can be recorded into a `DrawList`: it either flattens
+/// itself with `recordTo(DrawList&, sf::RenderStates) const`, or it is a
+/// copyable drawable other than `sf::Text`.
+/// @details `sf::Text` is excluded because copies share the glyph cache of
+/// their `sf::Font`, which drawing updates.
+template <typename T>
+inline constexpr bool isDrawListRecordable{
+    Impl::hasRecordTo<T> ||
+    (std::is_base_of_v<sf::Drawable, T> && std::is_copy_constructible_v<T> &&
+        !std::is_base_of_v<sf::Text, T>)};
+
+/// @brief Recorded sequence of draw calls that can be submitted to a render
+/// target later, possibly from another thread.
+/// @details Vertex data, views and drawables are copied at record time.
+/// Textures and shaders referenced by render states are stored by address
+/// and must outlive the submission.
+class DrawList
+{
+private:
+    using DrawFn =
+        std::function<void(sf::RenderTarget&, const sf::RenderStates&)>;
+
+    enum class Kind
+    {
+        Vertices,
+        Drawable,
+        View
+    };
+
+    struct Command
+    {
+        sf::RenderStates states;
+        std::size_t first, count;
+        sf::PrimitiveType primitive;
+        Kind kind;
+    };
+
+    std::vector<sf::Vertex> vertices;
+    std::vector<Command> commands;
+    std::vector<DrawFn> drawables;
+    std::vector<sf::View> views;
+    sf::Color clearColor{sf::Color::Transparent};
+    bool mustClear{false};
+
+public:
+    /// @brief Records a clear. Previously recorded draw calls are discarded,
+    /// as they would be overwritten anyway. The last recorded view is kept.
+    void clear(const sf::Color& mColor = sf::Color::Transparent)
+    {
+        const bool hadView(!views.empty());
+        const auto lastView(hadView ? views.back() : sf::View{});
+
+        reset();
+        if(hadView) setView(lastView);
+
+        clearColor = mColor;
+        mustClear = true;
+    }
+
+    /// @brief Records a view change, applied to the following draw calls.
+    void setView(const sf::View& mView)
+    {
+        commands.push_back({sf::RenderStates::Default, views.size(), 0,
+            sf::PrimitiveType::Points, Kind::View});
+        views.push_back(mView);
+    }
+
+    void add(const sf::Vertex* mVertices, std::size_t mCount,
+        sf::PrimitiveType mPrimitive,
+        const sf::RenderStates& mStates = sf::RenderStates::Default)
+    {
+        commands.push_back(
+            {mStates, vertices.size(), mCount, mPrimitive, Kind::Vertices});
+        vertices.insert(vertices.end(), mVertices, mVertices + mCount);
+    }
+
+    template <sf::PrimitiveType TPrimitive>
+    void add(const VertexVector<TPrimitive>& mVertices,
+        const sf::RenderStates& mStates = sf::RenderStates::Default)
+    {
+        add(mVertices.data(), mVertices.size(), TPrimitive, mStates);
+    }
+
+    /// @brief Records `mDrawable`, see `isDrawListRecordable`. Drawables
+    /// providing `recordTo` are flattened into vertices now, others are
+    /// copied.
+    template <typename T>
+    void add(const T& mDrawable,
+        const sf::RenderStates& mStates = sf::RenderStates::Default)
+    {
+        static_assert(isDrawListRecordable<T>,
+            "Only copyable drawables other than sf::Text, and drawables "
+            "providing `recordTo`, can be recorded");
+
+        if constexpr(Impl::hasRecordTo<T>)
+        {
+            mDrawable.recordTo(*this, mStates);
+        }
+        else
+        {
+            addCallback(
+                [copy = mDrawable](sf::RenderTarget& mRenderTarget,
+                    const sf::RenderStates& mRenderStates) {
+                    mRenderTarget.draw(copy, mRenderStates);
+                },
+                mStates);
+        }
+    }
+
+    /// @brief Records a call to `mFn(renderTarget, states)`, made by
+    /// `submit`. Anything `mFn` refers to must stay valid and unchanged
+    /// until then.
+    template <typename TF>
+    void addCallback(
+        TF&& mFn, const sf::RenderStates& mStates = sf::RenderStates::Default)
+    {
+        commands.push_back({mStates, drawables.size(), 0,
+            sf::PrimitiveType::Points, Kind::Drawable});
+        drawables.emplace_back(std::forward<TF>(mFn));
+    }
+
+    /// @brief Replays all recorded commands on `mRenderTarget`.
+    void submit(sf::RenderTarget& mRenderTarget) const
+    {
+        if(mustClear) mRenderTarget.clear(clearColor);
+
+        for(const auto& c : commands)
+        {
+            switch(c.kind)
+            {
+                case Kind::Vertices:
+                    mRenderTarget.draw(vertices.data() + c.first, c.count,
+                        c.primitive, c.states);
+                    break;
+                case Kind::Drawable:
+                    drawables[c.first](mRenderTarget, c.states);
+                    break;
+                case Kind::View: mRenderTarget.setView(views[c.first]); break;
+            }
+        }
+    }
+
+    /// @brief Discards all recorded commands, keeping allocated storage.
+    void reset() noexcept
+    {
+        vertices.clear();
+        commands.clear();
+        drawables.clear();
+        views.clear();
+        mustClear = false;
+    }
+
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return commands.empty() && !mustClear;
+    }
+
+    [[nodiscard]] std::size_t getCommandCount() const noexcept
+    {
+        return commands.size();
+    }
+
+    [[nodiscard]] std::size_t getVertexCount() const noexcept
+    {
+        return vertices.size();
+    }
+};
+
+} // namespace ssvs
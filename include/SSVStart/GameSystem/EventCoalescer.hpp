@@ -0,0 +1,153 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include "SSVStart/Global/Typedefs.hpp"
+
+#include <SFML/Window/Event.hpp>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace ssvs
+{
+
+/// @brief Buffers the events polled during a frame, merging bursts of
+/// `MouseMoved`, `Resized`, `MouseWheelScrolled` and `TouchMoved` events.
+/// @details Only runs of mergeable events are merged: any other event, such
+/// as a button press, ends the run, so that it sees the state delivered
+/// right before it. A merged event is delivered at the position of its
+/// last occurrence. Wheel deltas are summed per wheel, and touch movements
+/// are merged per finger.
+class EventCoalescer
+{
+private:
+    static constexpr std::size_t none{static_cast<std::size_t>(-1)};
+    static constexpr std::size_t wheelCount{2};
+
+    struct Entry
+    {
+        sf::Event event;
+        bool dropped;
+    };
+
+    std::vector<Entry> entries;
+    std::size_t mouseMovedSlot{none}, resizedSlot{none};
+    std::array<std::size_t, wheelCount> wheelSlots;
+    std::array<std::size_t, fingerCount> touchSlots;
+    std::size_t coalesced{0};
+
+    void resetSlots() noexcept
+    {
+        mouseMovedSlot = resizedSlot = none;
+        wheelSlots.fill(none);
+        touchSlots.fill(none);
+    }
+
+    /// @brief Drops the pending event in `mSlot`, if any, and stores the
+    /// index `mEvent` is about to be appended at.
+    void replace(std::size_t& mSlot, const sf::Event& mEvent)
+    {
+        if(mSlot != none)
+        {
+            entries[mSlot].dropped = true;
+            ++coalesced;
+        }
+
+        mSlot = entries.size();
+        entries.push_back({mEvent, false});
+    }
+
+    [[nodiscard]] std::size_t* getSlot(const sf::Event& mEvent) noexcept
+    {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+        switch(mEvent.type)
+        {
+            case sf::Event::MouseMoved: return &mouseMovedSlot;
+            case sf::Event::Resized: return &resizedSlot;
+            case sf::Event::MouseWheelScrolled:
+            {
+                const auto wheel(
+                    static_cast<std::size_t>(mEvent.mouseWheelScroll.wheel));
+                return wheel < wheelCount ? &wheelSlots[wheel] : nullptr;
+            }
+            case sf::Event::TouchMoved:
+            {
+                const auto finger(mEvent.touch.finger);
+                return finger < fingerCount ? &touchSlots[finger] : nullptr;
+            }
+            default: return nullptr;
+        }
+#pragma GCC diagnostic pop
+    }
+
+public:
+    EventCoalescer()
+    {
+        resetSlots();
+    }
+
+    void push(const sf::Event& mEvent)
+    {
+        auto* slot(getSlot(mEvent));
+
+        if(slot == nullptr)
+        {
+            resetSlots();
+            entries.push_back({mEvent, false});
+            return;
+        }
+
+        if(mEvent.type == sf::Event::MouseWheelScrolled && *slot != none)
+        {
+            auto merged(mEvent);
+            merged.mouseWheelScroll.delta +=
+                entries[*slot].event.mouseWheelScroll.delta;
+
+            replace(*slot, merged);
+            return;
+        }
+
+        replace(*slot, mEvent);
+    }
+
+    /// @brief Calls `mF` with every buffered event, in order, then clears
+    /// the buffer.
+    template <typename TF>
+    void flush(TF&& mF)
+    {
+        for(const auto& e : entries)
+            if(!e.dropped) mF(e.event);
+
+        clear();
+    }
+
+    void clear() noexcept
+    {
+        entries.clear();
+        resetSlots();
+    }
+
+    [[nodiscard]] bool isEmpty() const noexcept
+    {
+        return entries.empty();
+    }
+
+    /// @brief Returns the total number of events merged away since the last
+    /// call to `resetCoalescedCount`.
+    [[nodiscard]] std::size_t getCoalescedCount() const noexcept
+    {
+        return coalesced;
+    }
+
+    void resetCoalescedCount() noexcept
+    {
+        coalesced = 0;
+    }
+};
+
+} // namespace ssvs
@@ -0,0 +1,148 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace ssvs
+{
+
+/// @brief Linear allocator for memory that only lives until the end of the
+/// frame, usable as a `std::pmr::memory_resource`.
+/// @details Allocating bumps a pointer and deallocating does nothing; all
+/// memory is released at once by `reset`. Blocks are kept across resets. If
+/// a frame needed more than one block, they are merged into a single larger
+/// one on reset, so steady-state frames do not touch the heap. Not
+/// thread-safe.
+class FrameArena final : public std::pmr::memory_resource
+{
+private:
+    struct Block
+    {
+        std::unique_ptr<std::byte[]> data;
+        std::size_t size;
+    };
+
+    std::vector<Block> blocks;
+    std::size_t current{0}, offset{0};
+    std::size_t used{0}, peak{0}, upstreamAllocations{0};
+    std::size_t blockSize;
+
+    void addBlock(std::size_t mMinSize)
+    {
+        const auto size(std::max(blockSize, mMinSize));
+        blocks.push_back({std::make_unique<std::byte[]>(size), size});
+        ++upstreamAllocations;
+
+        blockSize = size * 2;
+    }
+
+    [[nodiscard]] void* tryAllocate(std::size_t mBytes, std::size_t mAlign)
+    {
+        if(current >= blocks.size()) return nullptr;
+
+        auto& b(blocks[current]);
+        void* ptr(b.data.get() + offset);
+        std::size_t space(b.size - offset);
+
+        if(std::align(mAlign, mBytes, ptr, space) == nullptr) return nullptr;
+
+        offset = static_cast<std::size_t>(
+                     static_cast<std::byte*>(ptr) - b.data.get()) +
+                 mBytes;
+        return ptr;
+    }
+
+    void* do_allocate(std::size_t mBytes, std::size_t mAlign) override
+    {
+        used += mBytes;
+        peak = std::max(peak, used);
+
+        if(auto* ptr = tryAllocate(mBytes, mAlign)) return ptr;
+
+        // Move to the next retained block, or add a new one that certainly
+        // fits the request.
+        while(++current < blocks.size())
+        {
+            offset = 0;
+            if(auto* ptr = tryAllocate(mBytes, mAlign)) return ptr;
+        }
+
+        addBlock(mBytes + mAlign);
+        current = blocks.size() - 1;
+        offset = 0;
+
+        return tryAllocate(mBytes, mAlign);
+    }
+
+    void do_deallocate(void*, std::size_t, std::size_t) noexcept override
+    {
+    }
+
+    [[nodiscard]] bool do_is_equal(
+        const std::pmr::memory_resource& mOther) const noexcept override
+    {
+        return this == &mOther;
+    }
+
+public:
+    FrameArena(std::size_t mInitialSize = 64 * 1024)
+        : blockSize{std::max(mInitialSize, std::size_t(64))}
+    {
+    }
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /// @brief Releases every allocation. Invalidates all memory handed out
+    /// since the last reset.
+    void reset()
+    {
+        if(blocks.size() > 1)
+        {
+            std::size_t total{0};
+            for(const auto& b : blocks) total += b.size;
+
+            blocks.clear();
+            blockSize = total;
+            addBlock(total);
+        }
+
+        current = offset = used = 0;
+    }
+
+    /// @brief Returns the number of bytes allocated since the last reset.
+    [[nodiscard]] std::size_t getUsed() const noexcept
+    {
+        return used;
+    }
+
+    /// @brief Returns the highest value `getUsed` ever reached.
+    [[nodiscard]] std::size_t getPeak() const noexcept
+    {
+        return peak;
+    }
+
+    [[nodiscard]] std::size_t getCapacity() const noexcept
+    {
+        std::size_t result{0};
+        for(const auto& b : blocks) result += b.size;
+
+        return result;
+    }
+
+    /// @brief Returns the number of blocks requested from the heap so far.
+    /// Stays constant once the arena has grown to fit the largest frame.
+    [[nodiscard]] std::size_t getUpstreamAllocationCount() const noexcept
+    {
+        return upstreamAllocations;
+    }
+};
+
+} // namespace ssvs
@@ -0,0 +1,347 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdio>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace ssvs
+{
+
+enum class CaptureFormat
+{
+    /// @brief One numbered PNG file per frame.
+    Png,
+
+    /// @brief All frames appended to a single file as tightly packed RGBA8
+    /// rows, e.g. for `ffmpeg -f rawvideo -pix_fmt rgba`.
+    RawRGBA
+};
+
+/// @brief Counters of a `FrameCapture`. `captured` counts the frames passed
+/// to `capture` while a screenshot or a capture was pending, `written` and
+/// `failed` count the images by outcome, and `dropped` counts the captured
+/// frames skipped because the queue was full.
+struct FrameCaptureStats
+{
+    std::size_t captured{0}, written{0}, failed{0}, dropped{0};
+};
+
+/// @brief Captures window frames and encodes them to disk on a worker
+/// thread.
+/// @details The read back of the frame still happens on the thread owning
+/// the GL context, but encoding and file I/O do not. At most `maxQueued`
+/// frames wait for the worker. When it falls behind, new frames are dropped
+/// before being read back instead of stalling the loop. A screenshot takes
+/// a slot of its own and waits for a free one instead of being dropped.
+class FrameCapture
+{
+private:
+    enum class JobType
+    {
+        Png,
+        Raw,
+        CloseRaw
+    };
+
+    struct Job
+    {
+        JobType type;
+        sf::Image image;
+        std::string path;
+    };
+
+    /// @brief Jobs a frame was given room for by `reserve`.
+    struct Reservation
+    {
+        std::string shotPath, framePath;
+        JobType frameType{JobType::Png};
+        bool frame{false};
+    };
+
+    sf::Texture texture;
+    std::deque<Job> jobs;
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::ofstream rawStream;
+    std::string rawPath;
+
+    // Guarded by `mutex`.
+    std::string screenshotPath, capturePrefix;
+    CaptureFormat captureFormat{CaptureFormat::Png};
+    std::size_t maxQueued{4}, frameIndex{0}, busy{0};
+    FrameCaptureStats stats;
+    bool capturing{false}, exiting{false};
+
+    std::atomic<bool> pending{false};
+
+    void refreshPending() noexcept
+    {
+        pending = capturing || !screenshotPath.empty();
+    }
+
+    void ensureWorker()
+    {
+        if(!worker.joinable()) worker = std::thread{[this] { workerLoop(); }};
+    }
+
+    [[nodiscard]] bool write(Job& mJob)
+    {
+        switch(mJob.type)
+        {
+            case JobType::Png: return mJob.image.saveToFile(mJob.path);
+            case JobType::Raw:
+            {
+                if(rawPath != mJob.path)
+                {
+                    rawStream.close();
+                    rawStream.open(mJob.path, std::ios::binary);
+                    rawPath = mJob.path;
+                }
+
+                const auto size(mJob.image.getSize());
+                rawStream.write(
+                    reinterpret_cast<const char*>(mJob.image.getPixelsPtr()),
+                    std::streamsize(size.x) * size.y * 4);
+                return static_cast<bool>(rawStream);
+            }
+            case JobType::CloseRaw:
+                rawStream.close();
+                rawPath.clear();
+                return true;
+        }
+
+        return false;
+    }
+
+    void workerLoop()
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+
+        while(true)
+        {
+            cv.wait(lock, [this] { return !jobs.empty() || exiting; });
+            if(jobs.empty()) break;
+
+            auto job(std::move(jobs.front()));
+            jobs.pop_front();
+            ++busy;
+            lock.unlock();
+
+            const bool ok(write(job));
+
+            lock.lock();
+            --busy;
+            if(job.type != JobType::CloseRaw)
+                ++(ok ? stats.written : stats.failed);
+            cv.notify_all();
+        }
+    }
+
+    [[nodiscard]] static std::string getFramePath(
+        const std::string& mPrefix, std::size_t mIndex)
+    {
+        char buf[16];
+        std::snprintf(buf, sizeof(buf), "%06zu.png", mIndex);
+        return mPrefix + buf;
+    }
+
+    // Called with `mutex` held. Takes the pending screenshot and the next
+    // captured frame if there is room for them, and returns false if the
+    // frame does not need to be read back.
+    [[nodiscard]] bool reserve(Reservation& mReservation)
+    {
+        if(!capturing && screenshotPath.empty()) return false;
+
+        ++stats.captured;
+
+        // Count the frame being written, so the bound holds for the total
+        // number of images alive at once.
+        const auto used(jobs.size() + busy);
+        auto room(used < maxQueued ? maxQueued - used : 0);
+
+        if(!screenshotPath.empty() && room > 0)
+        {
+            mReservation.shotPath.swap(screenshotPath);
+            --room;
+        }
+
+        if(capturing)
+        {
+            if(room > 0)
+            {
+                mReservation.frame = true;
+                mReservation.frameType = captureFormat == CaptureFormat::Png
+                                             ? JobType::Png
+                                             : JobType::Raw;
+                mReservation.framePath =
+                    captureFormat == CaptureFormat::Png
+                        ? getFramePath(capturePrefix, frameIndex)
+                        : capturePrefix;
+            }
+            else
+            {
+                ++stats.dropped;
+            }
+
+            ++frameIndex;
+        }
+
+        refreshPending();
+        return !mReservation.shotPath.empty() || mReservation.frame;
+    }
+
+    template <typename TF>
+    void captureImpl(TF&& mReadBack)
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+
+        Reservation r;
+        if(!reserve(r)) return;
+
+        lock.unlock();
+        sf::Image image(mReadBack());
+        lock.lock();
+
+        // The captured frame is queued last, so the image is only copied if
+        // both need it.
+        if(!r.shotPath.empty())
+        {
+            jobs.push_back({JobType::Png, r.frame ? image : std::move(image),
+                std::move(r.shotPath)});
+        }
+
+        if(r.frame)
+            jobs.push_back(
+                {r.frameType, std::move(image), std::move(r.framePath)});
+
+        ensureWorker();
+        cv.notify_all();
+    }
+
+public:
+    FrameCapture() = default;
+
+    FrameCapture(const FrameCapture&) = delete;
+    FrameCapture& operator=(const FrameCapture&) = delete;
+
+    ~FrameCapture()
+    {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            exiting = true;
+        }
+
+        cv.notify_all();
+        if(worker.joinable()) worker.join();
+    }
+
+    /// @brief Sets the maximum number of frames waiting to be encoded. Each
+    /// one holds a full RGBA copy of the window.
+    void setMaxQueued(std::size_t mMaxQueued) noexcept
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        maxQueued = mMaxQueued;
+    }
+
+    /// @brief Saves the next captured frame to `mPath`.
+    void requestScreenshot(const std::string& mPath)
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        screenshotPath = mPath;
+        refreshPending();
+    }
+
+    /// @brief Starts capturing every frame. With `CaptureFormat::Png`,
+    /// frames are written to `<mPrefix>000000.png`, `<mPrefix>000001.png`,
+    /// and so on. With `CaptureFormat::RawRGBA`, they are appended to the
+    /// file `mPrefix`.
+    void startCapture(const std::string& mPrefix,
+        CaptureFormat mFormat = CaptureFormat::Png)
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        capturePrefix = mPrefix;
+        captureFormat = mFormat;
+        frameIndex = 0;
+        capturing = true;
+        refreshPending();
+    }
+
+    void stopCapture()
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        if(!capturing) return;
+
+        capturing = false;
+        refreshPending();
+
+        if(captureFormat == CaptureFormat::RawRGBA)
+        {
+            jobs.push_back({JobType::CloseRaw, {}, {}});
+            ensureWorker();
+            cv.notify_all();
+        }
+    }
+
+    /// @brief Returns true if the next frame should be passed to `capture`.
+    [[nodiscard]] bool isPending() const noexcept
+    {
+        return pending;
+    }
+
+    [[nodiscard]] bool isCapturing()
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        return capturing;
+    }
+
+    /// @brief Reads back the current contents of `mRenderWindow` and queues
+    /// them for encoding. Must be called from the thread owning the window's
+    /// GL context, after drawing and before displaying.
+    void capture(sf::RenderWindow& mRenderWindow)
+    {
+        captureImpl([&] {
+            const auto size(mRenderWindow.getSize());
+            if(texture.getSize() != size) texture.create(size.x, size.y);
+            texture.update(mRenderWindow);
+            return texture.copyToImage();
+        });
+    }
+
+    /// @brief Queues `mImage` as if it had been read back from a window,
+    /// e.g. the contents of an `sf::RenderTexture`.
+    void capture(const sf::Image& mImage)
+    {
+        captureImpl([&] { return mImage; });
+    }
+
+    /// @brief Blocks until every queued frame has been written.
+    void flush()
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        cv.wait(lock, [this] { return jobs.empty() && busy == 0; });
+    }
+
+    [[nodiscard]] FrameCaptureStats getStats()
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        return stats;
+    }
+};
+
+} // namespace ssvs
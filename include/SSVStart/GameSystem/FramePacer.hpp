@@ -0,0 +1,191 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <thread>
+
+namespace ssvs
+{
+
+struct FramePacerStats
+{
+    std::size_t frames{0}, missed{0};
+    double meanErrorMs{0.0}, stdDevErrorMs{0.0}, maxErrorMs{0.0};
+};
+
+/// @brief Default time source of `BasicFramePacer`.
+struct FramePacerClock
+{
+    using duration = std::chrono::steady_clock::duration;
+    using time_point = std::chrono::steady_clock::time_point;
+
+    [[nodiscard]] static time_point now() noexcept
+    {
+        return std::chrono::steady_clock::now();
+    }
+
+    static void sleepUntil(time_point mTimePoint)
+    {
+        std::this_thread::sleep_until(mTimePoint);
+    }
+
+    /// @brief Called repeatedly while spinning before a deadline.
+    static void yield() noexcept
+    {
+        std::this_thread::yield();
+    }
+};
+
+/// @brief Paces frames to a target rate by sleeping until shortly before
+/// the deadline and spinning for the remainder.
+/// @details Deadlines advance by a fixed period, so wake-up errors do not
+/// accumulate across frames. If a frame misses its deadline by more than a
+/// full period, the schedule is resynchronized instead of bursting.
+/// `TClock` provides the time, see `FramePacerClock`.
+template <typename TClock = FramePacerClock>
+class BasicFramePacer
+{
+private:
+    using Clock = TClock;
+    using Duration = typename Clock::duration;
+
+    Duration period{std::chrono::microseconds{16667}};
+    Duration spinMargin{std::chrono::milliseconds{1}};
+    Duration maxSpinMargin{std::chrono::milliseconds{2}};
+    Duration oversleep{0};
+    typename Clock::time_point deadline;
+    std::size_t frames{0}, missed{0};
+    double errorSum{0.0}, errorSqSum{0.0}, errorMax{0.0};
+    bool started{false}, adaptiveSpin{true};
+
+    void sleepUntil(typename Clock::time_point mTimePoint)
+    {
+        Clock::sleepUntil(mTimePoint);
+        if(!adaptiveSpin) return;
+
+        // Track a decaying maximum of the scheduler's oversleep, and spin
+        // for slightly longer than that.
+        const auto late(std::max(Clock::now() - mTimePoint, Duration{0}));
+        oversleep = std::max(late, oversleep - oversleep / 64);
+        spinMargin = std::min(
+            oversleep + std::chrono::microseconds{200}, maxSpinMargin);
+    }
+
+    void record(Duration mError) noexcept
+    {
+        const auto ms(std::chrono::duration<double, std::milli>(mError).count());
+
+        ++frames;
+        errorSum += ms;
+        errorSqSum += ms * ms;
+        errorMax = std::max(errorMax, ms);
+    }
+
+public:
+    BasicFramePacer(float mFPS = 60.f)
+    {
+        setTargetFPS(mFPS);
+    }
+
+    void setTargetFPS(float mFPS)
+    {
+        period = std::chrono::duration_cast<Duration>(
+            std::chrono::duration<double>(1.0 / std::max(mFPS, 1.f)));
+
+        reset();
+    }
+
+    /// @brief Sets the time spent spinning before each deadline. Disables
+    /// the automatic adjustment of the margin.
+    void setSpinMargin(Duration mMargin) noexcept
+    {
+        spinMargin = mMargin;
+        adaptiveSpin = false;
+    }
+
+    /// @brief Enables adjusting the spin margin to the measured sleep
+    /// overshoot, up to `mMaxMargin`. Enabled by default.
+    void setAdaptiveSpin(bool mEnabled,
+        Duration mMaxMargin = std::chrono::milliseconds{2}) noexcept
+    {
+        adaptiveSpin = mEnabled;
+        maxSpinMargin = mMaxMargin;
+    }
+
+    /// @brief Restarts the schedule from the next call to `wait`.
+    void reset() noexcept
+    {
+        started = false;
+    }
+
+    void resetStats() noexcept
+    {
+        frames = missed = 0;
+        errorSum = errorSqSum = errorMax = 0.0;
+    }
+
+    /// @brief Blocks until the current frame's deadline, then schedules the
+    /// next one.
+    void wait()
+    {
+        if(!started)
+        {
+            deadline = Clock::now() + period;
+            started = true;
+        }
+
+        if(Clock::now() < deadline - spinMargin)
+            sleepUntil(deadline - spinMargin);
+
+        // Spin, yielding so that other threads can use the core.
+        while(Clock::now() < deadline) Clock::yield();
+
+        const auto now(Clock::now());
+        record(now - deadline);
+
+        deadline += period;
+
+        if(now > deadline)
+        {
+            ++missed;
+            deadline = now + period;
+        }
+    }
+
+    [[nodiscard]] FramePacerStats getStats() const noexcept
+    {
+        FramePacerStats result;
+        result.frames = frames;
+        result.missed = missed;
+
+        if(frames == 0) return result;
+
+        const auto mean(errorSum / frames);
+        result.meanErrorMs = mean;
+        result.stdDevErrorMs =
+            std::sqrt(std::max(errorSqSum / frames - mean * mean, 0.0));
+        result.maxErrorMs = errorMax;
+
+        return result;
+    }
+
+    [[nodiscard]] Duration getPeriod() const noexcept
+    {
+        return period;
+    }
+
+    [[nodiscard]] Duration getSpinMargin() const noexcept
+    {
+        return spinMargin;
+    }
+};
+
+using FramePacer = BasicFramePacer<>;
+
+} // namespace ssvs
@@ -0,0 +1,223 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include "SSVStart/Global/Typedefs.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <ostream>
+#include <vector>
+
+namespace ssvs
+{
+
+enum class FramePhase : std::size_t
+{
+    Events,
+    Update,
+    Draw,
+    Display,
+    Pacing,
+    Timer,
+    Total
+};
+
+inline constexpr std::size_t framePhaseCount{7};
+
+[[nodiscard]] inline const char* getFramePhaseName(FramePhase mX) noexcept
+{
+    constexpr const char* names[framePhaseCount]{
+        "events", "update", "draw", "display", "pacing", "timer", "total"};
+
+    return names[static_cast<std::size_t>(mX)];
+}
+
+struct FrameProfilerStats
+{
+    float p50{0.f}, p95{0.f}, p99{0.f}, max{0.f};
+};
+
+/// @brief Ring-buffer profiler storing the duration of every phase of the
+/// last `windowSize` frames, in milliseconds.
+class FrameProfiler
+{
+private:
+    using Clock = std::chrono::high_resolution_clock;
+
+    std::array<std::vector<FT>, framePhaseCount> samples;
+    std::vector<float> ticks;
+    mutable std::vector<float> scratch;
+    std::array<FT, framePhaseCount> current{};
+    Clock::time_point lastMark{Clock::now()};
+    std::size_t windowSize, next{0}, count{0};
+
+    template <typename T>
+    [[nodiscard]] FrameProfilerStats getStatsImpl(
+        const std::vector<T>& mSamples) const
+    {
+        FrameProfilerStats result;
+        if(count == 0) return result;
+
+        scratch.assign(mSamples.begin(), mSamples.begin() + count);
+
+        // Nearest-rank percentile: the smallest sample that is greater than
+        // or equal to `mPercent`% of all samples, i.e. `ceil(p * n) - 1`.
+        const auto percentile([this](std::size_t mPercent) {
+            const auto idx((mPercent * count + 99) / 100 - 1);
+            std::nth_element(scratch.begin(), scratch.begin() + idx,
+                scratch.end());
+            return scratch[idx];
+        });
+
+        result.p50 = percentile(50);
+        result.p95 = percentile(95);
+        result.p99 = percentile(99);
+        result.max = *std::max_element(scratch.begin(), scratch.end());
+
+        return result;
+    }
+
+public:
+    FrameProfiler(std::size_t mWindowSize = 240)
+    {
+        setWindowSize(mWindowSize);
+    }
+
+    /// @brief Resizes the sampling window. Discards all recorded samples.
+    void setWindowSize(std::size_t mWindowSize)
+    {
+        windowSize = std::max(mWindowSize, std::size_t(1));
+
+        for(auto& s : samples) s.assign(windowSize, FT(0));
+        ticks.assign(windowSize, 0.f);
+        scratch.reserve(windowSize);
+
+        reset();
+    }
+
+    void reset() noexcept
+    {
+        current.fill(FT(0));
+        next = count = 0;
+    }
+
+    /// @brief Starts timing a new phase from the current point in time.
+    void mark() noexcept
+    {
+        lastMark = Clock::now();
+    }
+
+    /// @brief Attributes the time elapsed since the last mark to `mPhase`,
+    /// then marks again.
+    void record(FramePhase mPhase) noexcept
+    {
+        const auto now(Clock::now());
+        current[static_cast<std::size_t>(mPhase)] +=
+            std::chrono::duration_cast<FTDuration>(now - lastMark).count();
+        lastMark = now;
+    }
+
+    /// @brief Commits the current frame to the ring buffer.
+    /// @param mTicks Number of update ticks executed during the frame.
+    void endFrame(std::size_t mTicks) noexcept
+    {
+        constexpr auto totalIdx(static_cast<std::size_t>(FramePhase::Total));
+
+        current[totalIdx] = FT(0);
+        for(auto i(0u); i < totalIdx; ++i) current[totalIdx] += current[i];
+
+        for(auto i(0u); i < framePhaseCount; ++i)
+        {
+            samples[i][next] = current[i];
+            current[i] = FT(0);
+        }
+
+        ticks[next] = static_cast<float>(mTicks);
+
+        next = (next + 1) % windowSize;
+        count = std::min(count + 1, windowSize);
+    }
+
+    [[nodiscard]] FrameProfilerStats getStats(FramePhase mPhase) const
+    {
+        return getStatsImpl(samples[static_cast<std::size_t>(mPhase)]);
+    }
+
+    [[nodiscard]] FrameProfilerStats getTicksStats() const
+    {
+        return getStatsImpl(ticks);
+    }
+
+    /// @brief Returns the duration of `mPhase` in the last committed frame.
+    [[nodiscard]] FT getLast(FramePhase mPhase) const noexcept
+    {
+        if(count == 0) return FT(0);
+
+        const auto lastIdx((next + windowSize - 1) % windowSize);
+        return samples[static_cast<std::size_t>(mPhase)][lastIdx];
+    }
+
+    [[nodiscard]] float getLastTicks() const noexcept
+    {
+        return count == 0 ? 0.f : ticks[(next + windowSize - 1) % windowSize];
+    }
+
+    [[nodiscard]] std::size_t getWindowSize() const noexcept
+    {
+        return windowSize;
+    }
+
+    [[nodiscard]] std::size_t getSampleCount() const noexcept
+    {
+        return count;
+    }
+
+    /// @brief Prints a table with the percentiles of every phase, in ms,
+    /// then of the number of update ticks per frame. The format of
+    /// `mStream` is restored afterwards.
+    void dump(std::ostream& mStream) const
+    {
+        const auto printRow([&mStream](const char* mName,
+                                const FrameProfilerStats& mStats) {
+            mStream << std::setw(10) << mName << std::setw(10) << mStats.p50
+                    << std::setw(10) << mStats.p95 << std::setw(10)
+                    << mStats.p99 << std::setw(10) << mStats.max << '\n';
+        });
+
+        const auto printHeader([&mStream](const char* mName) {
+            mStream << std::setw(10) << mName << std::setw(10) << "p50"
+                    << std::setw(10) << "p95" << std::setw(10) << "p99"
+                    << std::setw(10) << "max" << '\n';
+        });
+
+        const auto flags(mStream.flags());
+        const auto precision(mStream.precision());
+
+        mStream << "frame profile (" << count << " frames, ms)\n";
+        printHeader("phase");
+        mStream << std::fixed << std::setprecision(3);
+
+        for(auto i(0u); i < framePhaseCount; ++i)
+        {
+            const auto phase(static_cast<FramePhase>(i));
+            printRow(getFramePhaseName(phase), getStats(phase));
+        }
+
+        // Tick counts are whole numbers of ticks, not durations.
+        mStream << "update ticks per frame\n";
+        printHeader("");
+        mStream << std::setprecision(0);
+        printRow("ticks", getTicksStats());
+
+        mStream.flags(flags);
+        mStream.precision(precision);
+    }
+};
+
+} // namespace ssvs
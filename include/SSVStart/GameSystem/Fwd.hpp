@@ -0,0 +1,30 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+/// @file Forward declarations of the game system. `GameEngine`, `GameWindow`
+/// and `GameHeadless` are aliases of class templates, so they cannot be
+/// forward-declared with `class GameWindow;`: include this file instead.
+
+namespace ssvs
+{
+
+class GameState;
+class GameTimer;
+
+template <typename>
+class BasicGameEngine;
+
+template <typename>
+class BasicGameWindow;
+
+template <typename>
+class BasicGameHeadless;
+
+using GameEngine = BasicGameEngine<GameTimer>;
+using GameWindow = BasicGameWindow<GameTimer>;
+using GameHeadless = BasicGameHeadless<GameTimer>;
+
+} // namespace ssvs
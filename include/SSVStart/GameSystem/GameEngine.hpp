@@ -4,149 +4,141 @@
 
 #pragma once
 
+#include "SSVStart/Global/Trace.hpp"
+#include "SSVStart/GameSystem/GameEngineBase.hpp"
 #include "SSVStart/GameSystem/GameTimer.hpp"
 #include "SSVStart/GameSystem/GameState.hpp"
 
-#include "SSVStart/Input/InputState.hpp"
-
 #include <SFML/Window/Event.hpp>
 
 #include <cassert>
+#include <type_traits>
 
 namespace ssvs
 {
 
-class GameWindow;
+template <typename>
+class BasicGameWindow;
+
+template <typename>
+class BasicGameHeadless;
 
-class GameEngine
+/// @brief Game engine driven by a timer of type `TTimer`.
+/// @details With `GameTimer` (the default) the timer can be swapped at
+/// runtime and is dispatched virtually. With a concrete timer type such as
+/// `TimerStatic`, the timer is stored by value and its calls are inlined into
+/// the loop.
+template <typename TTimer = GameTimer>
+class BasicGameEngine : public GameEngineBase
 {
-    friend GameWindow;
-    friend class TimerBase;
-    friend class TimerStatic;
-    friend class TimerDynamic;
+    template <typename>
+    friend class BasicGameWindow;
+
+    template <typename>
+    friend class BasicGameHeadless;
 
 private:
-    GameTimer timer;
-    GameState* gameState{nullptr};
-    Input::InputState* inputState{nullptr};
-    bool running{true};
+    static constexpr bool isRuntimeTimer{std::is_same_v<TTimer, GameTimer>};
+
+    Impl::TimerPolicy<TTimer> timer{*this};
 
     void refreshTimer()
     {
         timer.refresh();
     }
 
-    // These methods are called from the timer
-    void updateFromTimer(FT mFT)
-    {
-        assert(isValid());
-
-        if(inputState != nullptr)
-        {
-            gameState->updateInput(*inputState, mFT);
-        }
-
-        gameState->update(mFT);
-    }
-
-    void drawFromTimer()
-    {
-        assert(isValid());
-        gameState->draw();
-    }
-
-    void handleEvent(const sf::Event& mEvent) const noexcept
-    {
-        assert(isValid());
-        gameState->handleEvent(mEvent);
-    }
-
-    [[nodiscard]] bool isValid() const noexcept
+    void handleEvent(const sf::Event& mEvent) const
     {
-        return gameState != nullptr;
+        GameEngineBase::handleEvent(mEvent);
     }
 
 public:
-    GameEngine() = default;
-
-    GameEngine(const GameEngine&) = delete;
-    GameEngine& operator=(const GameEngine&) = delete;
-
-    void stop() noexcept
-    {
-        running = false;
-    }
+    BasicGameEngine() = default;
 
     void runUpdate()
     {
-        assert(isValid());
+        SSVS_PROFILE_SCOPE("GameEngine::runUpdate");
 
-        if(inputState != nullptr) gameState->refreshInput(*inputState);
-        timer->runUpdate();
-        gameState->onPostUpdate();
+        beginUpdate();
+        timer.get().runUpdate();
+        endUpdate();
     }
 
     void runDraw()
     {
-        assert(isValid());
+        SSVS_PROFILE_SCOPE("GameEngine::runDraw");
 
-        timer->runDraw();
+        assert(isValid());
+        timer.get().runDraw();
     }
 
     void runFPS()
     {
         assert(isValid());
 
-        timer->runFrameTime();
-        timer->runFPS();
+        timer.get().runFrameTime();
+        timer.get().runFPS();
     }
 
-    [[nodiscard]] float getFPS() const noexcept
+    /// @brief Like `runFPS`, but uses `mFrameTime` instead of measuring the
+    /// time elapsed since the last frame.
+    void runFPS(FT mFrameTime)
     {
-        return timer->getFPS();
-    }
+        assert(isValid());
 
-    void setGameState(GameState& mGameState) noexcept
-    {
-        gameState = &mGameState;
+        timer.get().setFrameTime(mFrameTime);
+        timer.get().runFPS();
     }
 
-    void setInputState(Input::InputState& mInputState) noexcept
+    [[nodiscard]] float getFPS() const noexcept
     {
-        inputState = &mInputState;
+        return timer.get().getFPS();
     }
 
-    [[nodiscard]] bool isRunning() const noexcept
+    [[nodiscard]] float getInterpolation() const noexcept
     {
-        return running;
+        return timer.get().getInterpolation();
     }
 
-    template <typename T>
+    template <typename T = TTimer>
     [[nodiscard]] T& getTimer()
     {
-        return timer.getImpl<T>();
+        if constexpr(isRuntimeTimer)
+        {
+            return timer.getGameTimer().template getImpl<T>();
+        }
+        else
+        {
+            static_assert(std::is_same_v<T, TTimer>);
+            return timer.get();
+        }
     }
 
     [[nodiscard]] bool hasTimer() const noexcept
     {
-        return timer.hasTimer();
+        return timer.has();
     }
 
     [[nodiscard]] TimerBase& getTimerBase() noexcept
     {
-        return timer.getBase();
+        return timer.get();
     }
 
     [[nodiscard]] const TimerBase& getTimerBase() const noexcept
     {
-        return timer.getBase();
+        return timer.get();
     }
 
     template <typename T, typename... TArgs>
     void setTimer(TArgs&&... mArgs)
     {
-        timer.setImpl<T>(*this, FWD(mArgs)...);
+        static_assert(isRuntimeTimer,
+            "Only engines using `GameTimer` can change timer at runtime");
+
+        timer.getGameTimer().template setImpl<T>(*this, FWD(mArgs)...);
     }
 };
 
+using GameEngine = BasicGameEngine<GameTimer>;
+
 } // namespace ssvs
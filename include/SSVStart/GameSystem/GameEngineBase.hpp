@@ -0,0 +1,150 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include "SSVStart/GameSystem/GameState.hpp"
+#include "SSVStart/GameSystem/JobSystem.hpp"
+#include "SSVStart/GameSystem/FrameArena.hpp"
+
+#include "SSVStart/Input/InputState.hpp"
+
+#include <SFML/Window/Event.hpp>
+
+#include <cassert>
+#include <cstddef>
+
+namespace ssvs
+{
+
+template <typename>
+class BasicGameEngine;
+
+/// @brief Timer-independent part of the engine. Timers hold a reference to
+/// it and call back into it for every simulation tick.
+class GameEngineBase
+{
+    template <typename>
+    friend class BasicGameEngine;
+    friend class TimerBase;
+    friend class TimerStatic;
+    friend class TimerDynamic;
+
+private:
+    GameState* gameState{nullptr};
+    Input::InputState* inputState{nullptr};
+    JobSystem jobSystem;
+    JobCounter tickJobs;
+    FrameArena frameArena;
+    std::size_t ticks{0};
+    bool running{true};
+
+    // These methods are called from the timer
+    void updateFromTimer(FT mFT)
+    {
+        assert(isValid());
+
+        if(inputState != nullptr)
+        {
+            gameState->updateInput(*inputState, mFT);
+        }
+
+        gameState->update(mFT);
+
+        // Join the jobs started during this tick, so that every tick of a
+        // multi-tick frame sees the results of the previous one.
+        jobSystem.wait(tickJobs);
+        ++ticks;
+    }
+
+    void drawFromTimer(float mInterpolation)
+    {
+        assert(isValid());
+        gameState->draw(mInterpolation);
+    }
+
+    void handleEvent(const sf::Event& mEvent) const
+    {
+        assert(isValid());
+        gameState->handleEvent(mEvent);
+    }
+
+    void beginUpdate()
+    {
+        assert(isValid());
+
+        if(inputState != nullptr) gameState->refreshInput(*inputState);
+        ticks = 0;
+    }
+
+    void endUpdate()
+    {
+        assert(isValid());
+        gameState->onPostUpdate();
+        frameArena.reset();
+    }
+
+    [[nodiscard]] bool isValid() const noexcept
+    {
+        return gameState != nullptr;
+    }
+
+protected:
+    GameEngineBase() = default;
+
+public:
+    GameEngineBase(const GameEngineBase&) = delete;
+    GameEngineBase& operator=(const GameEngineBase&) = delete;
+
+    void stop() noexcept
+    {
+        running = false;
+    }
+
+    /// @brief Returns the number of update ticks executed by the timer during
+    /// the last call to `runUpdate`.
+    [[nodiscard]] std::size_t getTicks() const noexcept
+    {
+        return ticks;
+    }
+
+    [[nodiscard]] JobSystem& getJobSystem() noexcept
+    {
+        return jobSystem;
+    }
+
+    /// @brief Runs `mF` on the job system. It is joined at the end of the
+    /// current update tick, before the next tick and before `onPostUpdate`.
+    template <typename TF>
+    void runAsync(TF&& mF)
+    {
+        jobSystem.submit(FWD(mF), tickJobs);
+    }
+
+    void setGameState(GameState& mGameState) noexcept
+    {
+        if(gameState != nullptr) gameState->frameArena = nullptr;
+
+        gameState = &mGameState;
+        gameState->frameArena = &frameArena;
+    }
+
+    /// @brief Returns the arena backing `GameState::getFrameResource`.
+    [[nodiscard]] FrameArena& getFrameArena() noexcept
+    {
+        return frameArena;
+    }
+
+    void setInputState(Input::InputState& mInputState) noexcept
+    {
+        inputState = &mInputState;
+    }
+
+    [[nodiscard]] bool isRunning() const noexcept
+    {
+        return running;
+    }
+};
+
+} // namespace ssvs
@@ -0,0 +1,395 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include "SSVStart/Global/Typedefs.hpp"
+#include "SSVStart/Input/Input.hpp"
+#include "SSVStart/GameSystem/GameEngine.hpp"
+#include "SSVStart/GameSystem/GameState.hpp"
+#include "SSVStart/GameSystem/BackgroundPolicy.hpp"
+#include "SSVStart/GameSystem/RedrawTracker.hpp"
+#include "SSVStart/GameSystem/Replay.hpp"
+
+#include <SSVUtils/Delegate/Delegate.hpp>
+
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace ssvs
+{
+
+struct HeadlessStats
+{
+    std::size_t frames{0}, ticks{0};
+    double seconds{0.0};
+
+    [[nodiscard]] double getTicksPerSecond() const noexcept
+    {
+        return seconds > 0.0 ? ticks / seconds : 0.0;
+    }
+
+    [[nodiscard]] double getFramesPerSecond() const noexcept
+    {
+        return seconds > 0.0 ? frames / seconds : 0.0;
+    }
+};
+
+/// @brief Drives a `BasicGameEngine` without a window or a GL context, using
+/// a synthetic frame time, a scripted input state and pushed window events.
+/// Frames are stepped as fast as the CPU allows.
+template <typename TTimer = GameTimer>
+class BasicGameHeadless
+{
+private:
+    using Engine = BasicGameEngine<TTimer>;
+
+    Input::InputState inputState;
+    std::unique_ptr<Engine> gameEngine{std::make_unique<Engine>()};
+    BackgroundController background;
+    RedrawTracker redraw;
+    std::vector<sf::Event> events;
+    std::size_t nextEvent{0};
+    FT frameTime{1.f};
+    std::size_t frames{0}, ticks{0}, pausedFrames{0};
+    bool drawEnabled{false};
+
+    void processEvent(const sf::Event& mEvent)
+    {
+        if(mEvent.type == sf::Event::Closed) gameEngine->stop();
+        if(mEvent.type == sf::Event::LostFocus) inputState.reset();
+
+        redraw.invalidate();
+        background.handleEvent(mEvent);
+        gameEngine->handleEvent(mEvent);
+    }
+
+    /// @brief Processes pushed events until `mStop` returns true, like a
+    /// window polls its queue.
+    template <typename TF>
+    void processEvents(TF&& mStop)
+    {
+        while(nextEvent < events.size() && !mStop())
+            processEvent(events[nextEvent++]);
+
+        if(nextEvent == events.size())
+        {
+            events.clear();
+            nextEvent = 0;
+        }
+    }
+
+    template <typename TF>
+    void stepImpl(FT mFrameTime, TF&& mBeforeUpdate)
+    {
+        assert(gameEngine != nullptr);
+
+        gameEngine->refreshTimer();
+        gameEngine->runFPS(mFrameTime);
+
+        mBeforeUpdate();
+
+        gameEngine->runUpdate();
+
+        if(drawEnabled && background.isDrawing() &&
+            redraw.beginFrame(gameEngine->getTicks() > 0))
+            gameEngine->runDraw();
+
+        ticks += gameEngine->getTicks();
+        ++frames;
+    }
+
+    template <typename TF>
+    HeadlessStats runImpl(TF&& mStep)
+    {
+        const auto startFrames(frames);
+        const auto startTicks(ticks);
+        const auto startTime(std::chrono::steady_clock::now());
+
+        while(gameEngine->isRunning() && mStep())
+        {
+        }
+
+        HeadlessStats result;
+        result.frames = frames - startFrames;
+        result.ticks = ticks - startTicks;
+        result.seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - startTime)
+                             .count();
+
+        return result;
+    }
+
+public:
+    /// @brief Called before every frame's update with the frame index, to
+    /// script the input state.
+    ssvu::Delegate<void(Input::InputState&, std::size_t)> onInput;
+
+    BasicGameHeadless()
+    {
+        gameEngine->setInputState(inputState);
+    }
+
+    BasicGameHeadless(const BasicGameHeadless&) = delete;
+    BasicGameHeadless& operator=(const BasicGameHeadless&) = delete;
+
+    BasicGameHeadless(BasicGameHeadless&&) = delete;
+    BasicGameHeadless& operator=(BasicGameHeadless&&) = delete;
+
+    /// @brief Steps a single frame of `mFrameTime` simulated time, after
+    /// processing the pushed events. While paused by the background policy,
+    /// only events are processed until focus is gained back, and the frame
+    /// is not stepped if it is not.
+    void step(FT mFrameTime)
+    {
+        if(background.isPaused())
+        {
+            processEvents([this] { return !background.isPaused(); });
+
+            if(background.isPaused())
+            {
+                ++pausedFrames;
+                return;
+            }
+        }
+
+        stepImpl(mFrameTime, [this] {
+            processEvents([] { return false; });
+            onInput(inputState, frames);
+
+            auto& timer(gameEngine->getTimerBase());
+            timer.setFrameTime(background.getFrameTime(timer.getFrameTime()));
+        });
+    }
+
+    /// @brief Steps a single recorded frame: restores its input state,
+    /// dispatches its events and runs with its frame time.
+    void step(const ReplayFrame& mFrame)
+    {
+        stepImpl(mFrame.frameTime, [this, &mFrame] {
+            inputState = mFrame.inputState;
+
+            for(const auto& e : mFrame.events)
+            {
+                redraw.invalidate();
+                if(e.type == sf::Event::Closed) gameEngine->stop();
+                gameEngine->handleEvent(e);
+            }
+        });
+    }
+
+    void step()
+    {
+        step(frameTime);
+    }
+
+    /// @brief Steps up to `mFrames` frames, or until the engine is stopped.
+    /// @return Returns statistics for the frames stepped by this call.
+    HeadlessStats run(std::size_t mFrames)
+    {
+        assert(gameEngine != nullptr);
+
+        std::size_t remaining(mFrames);
+        return runImpl([this, &remaining] {
+            if(remaining == 0) return false;
+
+            --remaining;
+            step();
+            return true;
+        });
+    }
+
+    /// @brief Replays up to `mMaxFrames` frames recorded by `ReplayRecorder`,
+    /// as fast as possible. Stops at the end of the log, or when the engine
+    /// is stopped.
+    /// @return Returns statistics for the frames stepped by this call.
+    HeadlessStats replay(ReplayPlayer& mPlayer,
+        std::size_t mMaxFrames = std::numeric_limits<std::size_t>::max())
+    {
+        assert(gameEngine != nullptr);
+
+        ReplayFrame frame;
+        std::size_t remaining(mMaxFrames);
+
+        return runImpl([this, &mPlayer, &frame, &remaining] {
+            if(remaining == 0 || !mPlayer.readFrame(frame)) return false;
+
+            --remaining;
+            step(frame);
+            return true;
+        });
+    }
+
+    void stop() noexcept
+    {
+        assert(gameEngine != nullptr);
+        gameEngine->stop();
+    }
+
+    /// @brief Queues `mEvent` to be processed at the start of the next frame,
+    /// as if polled from a window, e.g. `sf::Event::LostFocus`.
+    void pushEvent(const sf::Event& mEvent)
+    {
+        events.push_back(mEvent);
+    }
+
+    /// @brief Sets how frames run without focus, see `BackgroundPolicy`. The
+    /// focus is changed by pushing `LostFocus` and `GainedFocus` events.
+    void setBackgroundPolicy(const BackgroundPolicy& mPolicy) noexcept
+    {
+        background.setPolicy(mPolicy);
+    }
+
+    [[nodiscard]] const BackgroundPolicy& getBackgroundPolicy() const noexcept
+    {
+        return background.getPolicy();
+    }
+
+    [[nodiscard]] bool hasFocus() const noexcept
+    {
+        return background.hasFocus();
+    }
+
+    void setFrameTime(FT mFrameTime) noexcept
+    {
+        frameTime = mFrameTime;
+    }
+
+    /// @brief Enables calling `GameState::onDraw` every frame, e.g. to render
+    /// into an offscreen target. Disabled by default.
+    void setDrawEnabled(bool mEnabled) noexcept
+    {
+        drawEnabled = mEnabled;
+    }
+
+    /// @brief Enables retained mode, see `GameWindow::setRetainedMode`. Only
+    /// affects frames drawn with `setDrawEnabled`.
+    void setRetainedMode(bool mEnabled) noexcept
+    {
+        redraw.setEnabled(mEnabled);
+    }
+
+    /// @brief Forces the next frame to be redrawn in retained mode.
+    void invalidate() noexcept
+    {
+        redraw.invalidate();
+    }
+
+    void setGameState(GameState& mGameState) noexcept
+    {
+        assert(gameEngine != nullptr);
+        gameEngine->setGameState(mGameState);
+    }
+
+    template <typename T, typename... TArgs>
+    void setTimer(TArgs&&... mArgs)
+    {
+        assert(gameEngine != nullptr);
+        gameEngine->template setTimer<T, TArgs...>(FWD(mArgs)...);
+    }
+
+    template <typename T = TTimer>
+    [[nodiscard]] T& getTimer()
+    {
+        assert(gameEngine != nullptr);
+        return gameEngine->template getTimer<T>();
+    }
+
+    [[nodiscard]] FrameArena& getFrameArena() noexcept
+    {
+        assert(gameEngine != nullptr);
+        return gameEngine->getFrameArena();
+    }
+
+    [[nodiscard]] JobSystem& getJobSystem() noexcept
+    {
+        assert(gameEngine != nullptr);
+        return gameEngine->getJobSystem();
+    }
+
+    /// @brief Runs `mF` on the job system, joined at the end of the current
+    /// update tick. See `GameEngineBase::runAsync`.
+    template <typename TF>
+    void runAsync(TF&& mF)
+    {
+        assert(gameEngine != nullptr);
+        gameEngine->runAsync(FWD(mF));
+    }
+
+    [[nodiscard]] TimerBase& getTimerBase() noexcept
+    {
+        assert(gameEngine != nullptr);
+        return gameEngine->getTimerBase();
+    }
+
+    [[nodiscard]] const TimerBase& getTimerBase() const noexcept
+    {
+        assert(gameEngine != nullptr);
+        return gameEngine->getTimerBase();
+    }
+
+    [[nodiscard]] bool isRunning() const noexcept
+    {
+        assert(gameEngine != nullptr);
+        return gameEngine->isRunning();
+    }
+
+    [[nodiscard]] auto& getInputState() noexcept
+    {
+        return inputState;
+    }
+
+    [[nodiscard]] const auto& getInputState() const noexcept
+    {
+        return inputState;
+    }
+
+    [[nodiscard]] FT getFrameTime() const noexcept
+    {
+        return frameTime;
+    }
+
+    [[nodiscard]] std::size_t getFrames() const noexcept
+    {
+        return frames;
+    }
+
+    [[nodiscard]] std::size_t getTicks() const noexcept
+    {
+        return ticks;
+    }
+
+    [[nodiscard]] bool isRetainedMode() const noexcept
+    {
+        return redraw.isEnabled();
+    }
+
+    /// @brief Returns whether the next frame is redrawn in retained mode
+    /// even if no update tick runs.
+    [[nodiscard]] bool isInvalidated() const noexcept
+    {
+        return redraw.isInvalidated();
+    }
+
+    /// @brief Returns the number of frames not redrawn in retained mode.
+    [[nodiscard]] std::size_t getSkippedFrames() const noexcept
+    {
+        return redraw.getSkippedFrames();
+    }
+
+    /// @brief Returns the number of calls to `step` that were not stepped
+    /// because the background policy paused them.
+    [[nodiscard]] std::size_t getPausedFrames() const noexcept
+    {
+        return pausedFrames;
+    }
+};
+
+using GameHeadless = BasicGameHeadless<GameTimer>;
+
+} // namespace ssvs
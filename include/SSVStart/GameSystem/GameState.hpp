@@ -5,21 +5,27 @@
 #pragma once
 
 #include "SSVStart/Input/Input.hpp"
+#include "SSVStart/GameSystem/FrameArena.hpp"
 
 #include <SSVUtils/Delegate/Delegate.hpp>
 
 #include <SFML/Window/Event.hpp>
 
-#include <map>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
 
 namespace ssvs
 {
 
-class GameEngine;
+class GameEngineBase;
 
 class GameState
 {
-    friend GameEngine;
+    friend GameEngineBase;
 
 private:
     using ITrigger = Input::Trigger;
@@ -29,12 +35,14 @@ private:
     using EventDelegate = ssvu::Delegate<void(const sf::Event&)>;
 
     Input::Manager inputManager;
-    std::map<sf::Event::EventType, EventDelegate> eventDelegates;
+    std::array<EventDelegate, sf::Event::Count> eventDelegates;
+    FrameArena* frameArena{nullptr};
+    std::vector<std::shared_ptr<void>> keptAlive;
 
     void handleEvent(const sf::Event& mEvent)
     {
         onAnyEvent(mEvent);
-        eventDelegates[mEvent.type](mEvent);
+        eventDelegates[static_cast<std::size_t>(mEvent.type)](mEvent);
     }
 
     void update(FT mFT)
@@ -42,9 +50,10 @@ private:
         onUpdate(mFT);
     }
 
-    void draw()
+    void draw(float mInterpolation)
     {
         onDraw();
+        onDrawInterpolated(mInterpolation);
     }
 
     void updateInput(Input::InputState& mInputState, FT mFT)
@@ -60,6 +69,10 @@ private:
 public:
     ssvu::Delegate<void()> onDraw, onPostUpdate;
     ssvu::Delegate<void(FT)> onUpdate;
+
+    /// @brief Called right after `onDraw` with the timer's interpolation
+    /// factor between the previous and the current simulation tick.
+    ssvu::Delegate<void(float)> onDrawInterpolated;
     EventDelegate onAnyEvent;
 
     GameState() = default;
@@ -90,7 +103,30 @@ public:
 
     auto& onEvent(sf::Event::EventType mEventType)
     {
-        return eventDelegates[mEventType];
+        return eventDelegates[static_cast<std::size_t>(mEventType)];
+    }
+
+    /// @brief Returns the memory resource for allocations that only live
+    /// until the end of the current update: memory allocated from it is
+    /// released right after `onPostUpdate`. Falls back to the default
+    /// resource when the state is not attached to an engine.
+    [[nodiscard]] std::pmr::memory_resource& getFrameResource() noexcept
+    {
+        return frameArena != nullptr ? *frameArena
+                                     : *std::pmr::get_default_resource();
+    }
+
+    /// @brief Keeps `mX` alive until the state is destroyed, e.g. an
+    /// `AssetGroupScope` keeping the assets of a level loaded while the
+    /// level's state exists.
+    template <typename T>
+    std::decay_t<T>& keepAlive(T&& mX)
+    {
+        auto ptr(std::make_shared<std::decay_t<T>>(FWD(mX)));
+        auto& result(*ptr);
+
+        keptAlive.emplace_back(std::move(ptr));
+        return result;
     }
 
     void ignoreNextInputs() noexcept
@@ -5,12 +5,27 @@
 #pragma once
 
 #include "SSVStart/Global/Typedefs.hpp"
+#include "SSVStart/Global/Trace.hpp"
 #include "SSVStart/Input/Input.hpp"
+#include "SSVStart/GameSystem/Fwd.hpp"
+#include "SSVStart/GameSystem/FrameArena.hpp"
 #include "SSVStart/GameSystem/GameState.hpp"
+#include "SSVStart/GameSystem/FrameProfiler.hpp"
+#include "SSVStart/GameSystem/FramePacer.hpp"
+#include "SSVStart/GameSystem/BackgroundPolicy.hpp"
+#include "SSVStart/GameSystem/RedrawTracker.hpp"
+#include "SSVStart/GameSystem/DrawList.hpp"
+#include "SSVStart/GameSystem/RenderPipeline.hpp"
+#include "SSVStart/GameSystem/EventCoalescer.hpp"
+#include "SSVStart/GameSystem/Replay.hpp"
+#include "SSVStart/GameSystem/FrameCapture.hpp"
 #include "SSVStart/GameSystem/Timers/TimerBase.hpp"
 #include "SSVStart/GameSystem/GameTimer.hpp"
+#include "SSVStart/GameSystem/JobSystem.hpp"
+#include "SSVStart/GameSystem/GameEngineBase.hpp"
 #include "SSVStart/GameSystem/GameEngine.hpp"
 #include "SSVStart/GameSystem/GameWindow.hpp"
+#include "SSVStart/GameSystem/GameHeadless.hpp"
 #include "SSVStart/GameSystem/Timers/TimerStatic.hpp"
 #include "SSVStart/GameSystem/Timers/TimerDynamic.hpp"
 #include "SSVStart/GameSystem/Timers/TimerBase.inl"
@@ -14,7 +14,7 @@
 namespace ssvs
 {
 
-class GameEngine;
+class GameEngineBase;
 
 class GameTimer
 {
@@ -71,10 +71,86 @@ public:
     }
 
     template <typename T, typename... TArgs>
-    void setImpl(GameEngine& mGameEngine, TArgs&&... mArgs)
+    void setImpl(GameEngineBase& mGameEngine, TArgs&&... mArgs)
     {
         nextImpl = std::make_unique<T>(mGameEngine, FWD(mArgs)...);
     }
 };
 
+namespace Impl
+{
+
+/// @brief Stores a timer of statically known type by value, so that calls
+/// to its (final) virtual functions are resolved at compile-time.
+template <typename TTimer>
+class TimerPolicy
+{
+private:
+    TTimer timer;
+
+public:
+    TimerPolicy(GameEngineBase& mGameEngine) : timer{mGameEngine}
+    {
+    }
+
+    void refresh() noexcept
+    {
+    }
+
+    [[nodiscard]] TTimer& get() noexcept
+    {
+        return timer;
+    }
+
+    [[nodiscard]] const TTimer& get() const noexcept
+    {
+        return timer;
+    }
+
+    [[nodiscard]] bool has() const noexcept
+    {
+        return true;
+    }
+};
+
+/// @brief Runtime-swappable timer, dispatched through `TimerBase`.
+template <>
+class TimerPolicy<GameTimer>
+{
+private:
+    GameTimer timer;
+
+public:
+    TimerPolicy(GameEngineBase&) noexcept
+    {
+    }
+
+    void refresh() noexcept
+    {
+        timer.refresh();
+    }
+
+    [[nodiscard]] TimerBase& get() noexcept
+    {
+        return timer.getBase();
+    }
+
+    [[nodiscard]] const TimerBase& get() const noexcept
+    {
+        return timer.getBase();
+    }
+
+    [[nodiscard]] bool has() const noexcept
+    {
+        return timer.hasTimer();
+    }
+
+    [[nodiscard]] GameTimer& getGameTimer() noexcept
+    {
+        return timer;
+    }
+};
+
+} // namespace Impl
+
 } // namespace ssvs
@@ -5,9 +5,19 @@
 #pragma once
 
 #include "SSVStart/Global/Typedefs.hpp"
+#include "SSVStart/Global/Trace.hpp"
 #include "SSVStart/Input/Input.hpp"
 #include "SSVStart/GameSystem/GameEngine.hpp"
 #include "SSVStart/GameSystem/GameState.hpp"
+#include "SSVStart/GameSystem/FrameProfiler.hpp"
+#include "SSVStart/GameSystem/FramePacer.hpp"
+#include "SSVStart/GameSystem/BackgroundPolicy.hpp"
+#include "SSVStart/GameSystem/RedrawTracker.hpp"
+#include "SSVStart/GameSystem/DrawList.hpp"
+#include "SSVStart/GameSystem/RenderPipeline.hpp"
+#include "SSVStart/GameSystem/EventCoalescer.hpp"
+#include "SSVStart/GameSystem/Replay.hpp"
+#include "SSVStart/GameSystem/FrameCapture.hpp"
 
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Mouse.hpp>
@@ -17,72 +27,216 @@
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/View.hpp>
 
+#include <SSVUtils/Core/Log/Log.hpp>
+
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
+#include <memory_resource>
+#include <optional>
+#include <type_traits>
 
 namespace ssvs
 {
 
-class GameWindow
+template <typename TTimer = GameTimer>
+class BasicGameWindow
 {
 private:
+    using Engine = BasicGameEngine<TTimer>;
+
     Input::InputState inputState;
-    std::unique_ptr<GameEngine> gameEngine{
-        std::make_unique<GameEngine>()}; // TODO: should the user create a
-                                         // GameEngine?
+    std::unique_ptr<Engine> gameEngine{
+        std::make_unique<Engine>()}; // TODO: should the user create a
+                                     // GameEngine?
     sf::RenderWindow renderWindow;
+    FrameCapture frameCapture;
+    RenderPipeline pipeline{renderWindow};
+    sf::View view;
     std::string title;
+    FrameProfiler profiler;
+    FramePacer pacer, backgroundPacer{10.f};
+    BackgroundController background;
+    RedrawTracker redraw;
+    EventCoalescer coalescer;
+    std::optional<ReplayRecorder> recorder;
     FT msUpdate, msDraw;
     float maxFPS{60.f}, pixelMult{1.f};
     unsigned int width{640}, height{480}, antialiasingLevel{3};
-    bool fpsLimited{false}, focus{true}, mustRecreate{true}, vsync{false},
-        fullscreen{false};
+    bool fpsLimited{false}, mustRecreate{true}, vsync{false},
+        fullscreen{false}, pipelined{false}, coalesceEvents{false},
+        warnedUnrecordable{false};
+
+    template <typename T>
+    void drawByCallback(const T& mDrawable, const sf::RenderStates& mStates)
+    {
+        if(!warnedUnrecordable)
+        {
+            ssvu::lo("ssvs::GameWindow::draw")
+                << "drawable cannot be recorded, drawing it through a "
+                   "callback on the render thread\n";
+            warnedUnrecordable = true;
+        }
+
+        if constexpr(std::is_copy_constructible_v<T>)
+        {
+            pipeline.getRecordList().addCallback(
+                [copy = mDrawable](sf::RenderTarget& mTarget,
+                    const sf::RenderStates& mX) { mTarget.draw(copy, mX); },
+                mStates);
+        }
+        else
+        {
+            pipeline.getRecordList().addCallback(
+                [&mDrawable](sf::RenderTarget& mTarget,
+                    const sf::RenderStates& mX) {
+                    mTarget.draw(mDrawable, mX);
+                },
+                mStates);
+        }
+    }
+
+    void dispatchEvent(const sf::Event& mEvent)
+    {
+        if(recorder) recorder->recordEvent(mEvent);
+        gameEngine->handleEvent(mEvent);
+    }
+
+    void onFocusGained()
+    {
+        // Time spent in the background must not show up as a single huge
+        // frame, and both pacers must restart their schedules.
+        gameEngine->getTimerBase().restartClock();
+        pacer.reset();
+        backgroundPacer.reset();
+    }
+
+    void processEvent(const sf::Event& mEvent)
+    {
+        redraw.invalidate();
+
+        if(background.handleEvent(mEvent)) onFocusGained();
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+        switch(mEvent.type)
+        {
+            case sf::Event::Closed: gameEngine->stop(); break;
+            case sf::Event::LostFocus: inputState.reset(); break;
+            case sf::Event::KeyPressed:
+                inputState[mEvent.key.code] = true;
+                break;
+            case sf::Event::KeyReleased:
+                inputState[mEvent.key.code] = false;
+                break;
+            case sf::Event::MouseButtonPressed:
+                inputState[mEvent.mouseButton.button] = true;
+                break;
+            case sf::Event::MouseButtonReleased:
+                inputState[mEvent.mouseButton.button] = false;
+                break;
+            case sf::Event::TouchBegan:
+                inputState.getFinger(mEvent.touch.finger) = true;
+                break;
+            case sf::Event::TouchEnded:
+                inputState.getFinger(mEvent.touch.finger) = false;
+                break;
+            default: break;
+        }
+#pragma GCC diagnostic pop
+
+        if(coalesceEvents)
+        {
+            coalescer.push(mEvent);
+        }
+        else
+        {
+            dispatchEvent(mEvent);
+        }
+    }
+
+    /// @brief Blocks on the window's event queue until it regains focus or
+    /// is closed.
+    void waitForFocus()
+    {
+        sf::Event event;
+        while(background.isPaused() && gameEngine->isRunning() &&
+              renderWindow.waitEvent(event))
+        {
+            processEvent(event);
+        }
+    }
+
+    void present()
+    {
+        SSVS_PROFILE_SCOPE("GameWindow::present");
+
+        if(pipelined)
+        {
+            pipeline.present();
+        }
+        else
+        {
+            renderWindow.display();
+        }
+    }
+
+    void pace(bool mThrottled, bool mSkipped)
+    {
+        SSVS_PROFILE_SCOPE("GameWindow::pace");
+
+        if(mThrottled)
+        {
+            backgroundPacer.wait();
+        }
+        else if(fpsLimited || mSkipped)
+        {
+            // Skipped frames do not block on `display`, so they are always
+            // paced.
+            pacer.wait();
+        }
+    }
+
+    void captureFrame()
+    {
+        if(pipeline.isRunning())
+        {
+            pipeline.post([this](sf::RenderWindow& mRenderWindow) {
+                frameCapture.capture(mRenderWindow);
+            });
+            return;
+        }
+
+        frameCapture.capture(renderWindow);
+    }
 
     void runEvents()
     {
+        SSVS_PROFILE_SCOPE("GameWindow::runEvents");
+
         assert(gameEngine != nullptr);
 
         sf::Event event;
-        while(renderWindow.pollEvent(event))
+        while(renderWindow.pollEvent(event)) processEvent(event);
+
+        if(coalesceEvents)
         {
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wswitch-enum"
-            switch(event.type)
-            {
-                case sf::Event::Closed: gameEngine->stop(); break;
-                case sf::Event::GainedFocus: focus = true; break;
-                case sf::Event::LostFocus:
-                    inputState.reset();
-                    focus = false;
-                    break;
-                case sf::Event::KeyPressed:
-                    inputState[event.key.code] = true;
-                    break;
-                case sf::Event::KeyReleased:
-                    inputState[event.key.code] = false;
-                    break;
-                case sf::Event::MouseButtonPressed:
-                    inputState[event.mouseButton.button] = true;
-                    break;
-                case sf::Event::MouseButtonReleased:
-                    inputState[event.mouseButton.button] = false;
-                    break;
-                case sf::Event::TouchBegan:
-                    inputState.getFinger(event.touch.finger) = true;
-                    break;
-                case sf::Event::TouchEnded:
-                    inputState.getFinger(event.touch.finger) = false;
-                    break;
-                default: break;
-            }
+            coalescer.flush(
+                [this](const sf::Event& mEvent) { dispatchEvent(mEvent); });
+        }
 
-            gameEngine->handleEvent(event);
+        if(recorder)
+        {
+            recorder->endFrame(
+                gameEngine->getTimerBase().getFrameTime(), inputState);
         }
-#pragma GCC diagnostic pop
     }
 
     void recreateWindow()
     {
+        pipeline.stop();
         if(renderWindow.isOpen()) renderWindow.close();
 
         renderWindow.create({width, height}, title,
@@ -91,9 +245,10 @@ private:
 
         renderWindow.setSize(Vec2u(width * pixelMult, height * pixelMult));
         renderWindow.setVerticalSyncEnabled(vsync);
-        renderWindow.setFramerateLimit(fpsLimited ? maxFPS : 0);
+        pacer.reset();
 
         inputState.reset();
+        redraw.invalidate();
 
         mustRecreate = false;
         onRecreation();
@@ -102,16 +257,16 @@ private:
 public:
     ssvu::Delegate<void()> onRecreation;
 
-    GameWindow()
+    BasicGameWindow()
     {
         gameEngine->setInputState(inputState);
     }
 
-    GameWindow(const GameWindow&) = delete;
-    GameWindow& operator=(const GameWindow&) = delete;
+    BasicGameWindow(const BasicGameWindow&) = delete;
+    BasicGameWindow& operator=(const BasicGameWindow&) = delete;
 
-    GameWindow(GameWindow&&) = delete;
-    GameWindow& operator=(GameWindow&&) = delete;
+    BasicGameWindow(BasicGameWindow&&) = delete;
+    BasicGameWindow& operator=(BasicGameWindow&&) = delete;
 
     void run()
     {
@@ -119,33 +274,82 @@ public:
 
         while(gameEngine->isRunning())
         {
+            SSVS_PROFILE_SCOPE("GameWindow::frame");
+
             if(mustRecreate) recreateWindow();
 
-            renderWindow.setActive(true);
-            this->clear();
+            if(pipelined)
+            {
+                // From now on, the render thread owns the window's view.
+                if(!pipeline.isRunning()) view = renderWindow.getView();
+                pipeline.start();
+            }
+            else
+            {
+                pipeline.stop();
+                renderWindow.setActive(true);
+            }
+
+            if(background.isPaused()) waitForFocus();
+
+            bool drawing(background.isDrawing());
+
+            // In retained mode, whether to draw is only known after the
+            // update, so clearing is deferred until then.
+            if(drawing && !redraw.isEnabled()) this->clear();
 
             gameEngine->refreshTimer();
 
-            auto tempMs(std::chrono::high_resolution_clock::now());
+            profiler.mark();
+
+            runEvents();
+            profiler.record(FramePhase::Events);
+
+            gameEngine->runUpdate();
+            profiler.record(FramePhase::Update);
+
+            bool skipped(false);
+            if(drawing && redraw.isEnabled())
             {
-                runEvents();
-                gameEngine->runUpdate();
+                drawing = redraw.beginFrame(
+                    gameEngine->getTicks() > 0 || frameCapture.isPending());
+
+                if(drawing)
+                    this->clear();
+                else
+                    skipped = true;
             }
-            msUpdate = std::chrono::duration_cast<FTDuration>(
-                std::chrono::high_resolution_clock::now() - tempMs)
-                           .count();
 
-            tempMs = std::chrono::high_resolution_clock::now();
+            if(drawing)
             {
                 gameEngine->runDraw();
-                renderWindow.display();
+                if(frameCapture.isPending()) captureFrame();
+                profiler.record(FramePhase::Draw);
+
+                present();
+                profiler.record(FramePhase::Display);
             }
-            msDraw = std::chrono::duration_cast<FTDuration>(
-                std::chrono::high_resolution_clock::now() - tempMs)
-                         .count();
+
+            const bool throttled(background.isThrottled());
+
+            pace(throttled, skipped);
+            profiler.record(FramePhase::Pacing);
 
             gameEngine->runFPS();
+            auto& timer(gameEngine->getTimerBase());
+            timer.setFrameTime(background.getFrameTime(timer.getFrameTime()));
+            profiler.record(FramePhase::Timer);
+
+            profiler.endFrame(gameEngine->getTicks());
+
+            msUpdate = profiler.getLast(FramePhase::Events) +
+                       profiler.getLast(FramePhase::Update);
+            msDraw = profiler.getLast(FramePhase::Draw) +
+                     profiler.getLast(FramePhase::Display);
         }
+
+        pipeline.stop();
+        if(recorder) recorder->flush();
     }
     void stop() noexcept
     {
@@ -153,23 +357,127 @@ public:
         gameEngine->stop();
     }
 
+    /// @brief Starts recording every frame's input state, dispatched events
+    /// and frame time into `mStream`, which must outlive the recording. The
+    /// log can be replayed with `GameHeadless::replay`.
+    void startRecording(std::ostream& mStream)
+    {
+        recorder.emplace(mStream);
+    }
+
+    void stopRecording()
+    {
+        if(!recorder) return;
+
+        recorder->flush();
+        recorder.reset();
+    }
+
+    [[nodiscard]] bool isRecording() const noexcept
+    {
+        return recorder.has_value();
+    }
+
     void clear(const sf::Color& mColor = sf::Color::Transparent)
     {
+        if(pipelined)
+        {
+            pipeline.getRecordList().clear(mColor);
+            return;
+        }
+
         renderWindow.clear(mColor);
     }
-    void draw(const sf::Drawable& mDrawable,
+
+    /// @brief Draws `mDrawable`. In pipelined mode, the draw call is recorded
+    /// (see `DrawList::add`) and submitted by the render thread.
+    /// @details Drawables that cannot be recorded, see
+    /// `isDrawListRecordable`, are drawn by the render thread through a
+    /// callback: a copy of them if they are copyable, such as `sf::Text`,
+    /// otherwise `mDrawable` itself, which must then outlive the frame. The
+    /// first such call is logged, as the render thread may race with the
+    /// game on the state they share, such as the glyphs of a font.
+    template <typename T>
+    void draw(const T& mDrawable,
         const sf::RenderStates& mStates = sf::RenderStates::Default)
     {
+        if(pipelined)
+        {
+            if constexpr(isDrawListRecordable<T>)
+                pipeline.getRecordList().add(mDrawable, mStates);
+            else
+                drawByCallback(mDrawable, mStates);
+
+            return;
+        }
+
         renderWindow.draw(mDrawable, mStates);
     }
 
-    void saveScreenshot(const std::string& mPath) const
+    void draw(const sf::Vertex* mVertices, std::size_t mCount,
+        sf::PrimitiveType mPrimitive,
+        const sf::RenderStates& mStates = sf::RenderStates::Default)
+    {
+        if(pipelined)
+        {
+            pipeline.getRecordList().add(
+                mVertices, mCount, mPrimitive, mStates);
+            return;
+        }
+
+        renderWindow.draw(mVertices, mCount, mPrimitive, mStates);
+    }
+
+    /// @brief Sets the view of the following draw calls. In pipelined mode,
+    /// the change is recorded and applied by the render thread.
+    void setView(const sf::View& mView)
+    {
+        view = mView;
+
+        if(pipelined)
+        {
+            pipeline.getRecordList().setView(mView);
+            return;
+        }
+
+        renderWindow.setView(mView);
+    }
+
+    [[nodiscard]] const sf::View& getView() const noexcept
+    {
+        return pipelined ? view : renderWindow.getView();
+    }
+
+    [[nodiscard]] const sf::View& getDefaultView() const noexcept
+    {
+        return renderWindow.getDefaultView();
+    }
+
+    /// @brief Saves the current contents of the window to `mPath` right
+    /// away. Not available while the render pipeline is running, as the
+    /// window's GL context belongs to the render thread, see
+    /// `requestScreenshot`.
+    bool saveScreenshot(const std::string& mPath) const
     {
+        assert(!pipeline.isRunning());
+
         sf::Texture t;
         t.create(renderWindow.getSize().x, renderWindow.getSize().y);
         t.update(renderWindow);
-        auto img = t.copyToImage();
-        img.saveToFile(mPath);
+        return t.copyToImage().saveToFile(mPath);
+    }
+
+    /// @brief Saves the next frame to `mPath` once it has been drawn,
+    /// without blocking. The image is encoded on a worker thread, see
+    /// `FrameCapture`.
+    void requestScreenshot(const std::string& mPath)
+    {
+        frameCapture.requestScreenshot(mPath);
+    }
+
+    [[nodiscard]] FrameCapture& getFrameCapture() noexcept
+    {
+        return frameCapture;
     }
 
     void setFullscreen(bool mFullscreen) noexcept
@@ -211,12 +519,48 @@ public:
     void setMaxFPS(float mMaxFPS)
     {
         maxFPS = mMaxFPS;
-        renderWindow.setFramerateLimit(fpsLimited ? maxFPS : 0);
+        pacer.setTargetFPS(maxFPS);
     }
     void setFPSLimited(bool mFPSLimited)
     {
         fpsLimited = mFPSLimited;
-        renderWindow.setFramerateLimit(fpsLimited ? maxFPS : 0);
+        pacer.reset();
+    }
+    /// @brief Enables retained mode: a frame is only redrawn if an update
+    /// tick ran, an event arrived or `invalidate` was called. Other frames
+    /// are only paced at the maximum FPS. Frames without ticks do not show
+    /// the timer's interpolation. Disabled by default.
+    void setRetainedMode(bool mEnabled) noexcept
+    {
+        redraw.setEnabled(mEnabled);
+    }
+    /// @brief Forces the next frame to be redrawn in retained mode.
+    void invalidate() noexcept
+    {
+        redraw.invalidate();
+    }
+    /// @brief Sets how the window behaves while it does not have focus. By
+    /// default it keeps running at full rate.
+    void setBackgroundPolicy(const BackgroundPolicy& mPolicy)
+    {
+        background.setPolicy(mPolicy);
+        backgroundPacer.setTargetFPS(mPolicy.fps);
+    }
+    /// @brief Enables overlapping the update of frame N+1 with the submission
+    /// of frame N on a dedicated render thread. While enabled, draw and set
+    /// views only through `GameWindow` and not directly on the
+    /// `sf::RenderWindow`.
+    void setPipelined(bool mPipelined) noexcept
+    {
+        pipelined = mPipelined;
+    }
+    /// @brief Enables merging uninterrupted runs of `MouseMoved`, `Resized`,
+    /// `MouseWheelScrolled` and `TouchMoved` events polled in a frame into
+    /// one event before they reach the game state, see `EventCoalescer`.
+    /// The input state still sees every event. Disabled by default.
+    void setEventCoalescing(bool mEnabled) noexcept
+    {
+        coalesceEvents = mEnabled;
     }
     void setGameState(GameState& mGameState) noexcept
     {
@@ -254,12 +598,37 @@ public:
     }
     bool hasFocus() const noexcept
     {
-        return focus;
+        return background.hasFocus();
     }
     bool getVsync() const noexcept
     {
         return vsync;
     }
+    bool isPipelined() const noexcept
+    {
+        return pipelined;
+    }
+    const auto& getBackgroundPolicy() const noexcept
+    {
+        return background.getPolicy();
+    }
+    bool isRetainedMode() const noexcept
+    {
+        return redraw.isEnabled();
+    }
+    /// @brief Returns the number of frames not redrawn in retained mode.
+    std::size_t getSkippedFrames() const noexcept
+    {
+        return redraw.getSkippedFrames();
+    }
+    bool isEventCoalescing() const noexcept
+    {
+        return coalesceEvents;
+    }
+    const auto& getEventCoalescer() const noexcept
+    {
+        return coalescer;
+    }
 
     FT getMsUpdate() const noexcept
     {
@@ -270,15 +639,40 @@ public:
         return msDraw;
     }
 
+    [[nodiscard]] FrameProfiler& getProfiler() noexcept
+    {
+        return profiler;
+    }
+
+    [[nodiscard]] const FrameProfiler& getProfiler() const noexcept
+    {
+        return profiler;
+    }
+
+    [[nodiscard]] FramePacer& getPacer() noexcept
+    {
+        return pacer;
+    }
+
+    [[nodiscard]] const FramePacer& getPacer() const noexcept
+    {
+        return pacer;
+    }
+
+    void dumpProfile(std::ostream& mStream) const
+    {
+        profiler.dump(mStream);
+    }
+
     auto getMousePosition() const noexcept
     {
         return renderWindow.mapPixelToCoords(
-            sf::Mouse::getPosition(renderWindow));
+            sf::Mouse::getPosition(renderWindow), getView());
     }
     auto getFingerPosition(FingerID mX) const noexcept
     {
         return renderWindow.mapPixelToCoords(
-            sf::Touch::getPosition(mX, renderWindow));
+            sf::Touch::getPosition(mX, renderWindow), getView());
     }
 
     const auto& getInputState() const noexcept
@@ -300,12 +694,52 @@ public:
 
         return result;
     }
+    /// @brief Like `getFingerDownPositions()`, but allocates from `mResource`,
+    /// e.g. `GameState::getFrameResource()`.
+    auto getFingerDownPositions(std::pmr::memory_resource& mResource) const
+    {
+        std::pmr::vector<Vec2i> result{&mResource};
+        result.reserve(getFingerDownCount());
+
+        for(auto i(0u); i < fingerCount; ++i)
+            if(inputState.fingers[i]) result.emplace_back(getFingerPosition(i));
+
+        return result;
+    }
 
     template <typename T, typename... TArgs>
     void setTimer(TArgs&&... mArgs)
     {
         assert(gameEngine != nullptr);
-        gameEngine->setTimer<T, TArgs...>(FWD(mArgs)...);
+        gameEngine->template setTimer<T, TArgs...>(FWD(mArgs)...);
+    }
+
+    template <typename T = TTimer>
+    [[nodiscard]] T& getTimer()
+    {
+        assert(gameEngine != nullptr);
+        return gameEngine->template getTimer<T>();
+    }
+
+    [[nodiscard]] FrameArena& getFrameArena() noexcept
+    {
+        assert(gameEngine != nullptr);
+        return gameEngine->getFrameArena();
+    }
+
+    [[nodiscard]] JobSystem& getJobSystem() noexcept
+    {
+        assert(gameEngine != nullptr);
+        return gameEngine->getJobSystem();
+    }
+
+    /// @brief Runs `mF` on the job system, joined at the end of the current
+    /// update tick. See `GameEngineBase::runAsync`.
+    template <typename TF>
+    void runAsync(TF&& mF)
+    {
+        assert(gameEngine != nullptr);
+        gameEngine->runAsync(FWD(mF));
     }
 
     [[nodiscard]] TimerBase& getTimerBase() noexcept
@@ -332,10 +766,18 @@ public:
         return gameEngine->getFPS();
     }
 
+    auto getInterpolation() const noexcept
+    {
+        assert(gameEngine != nullptr);
+        return gameEngine->getInterpolation();
+    }
+
     void recreate() noexcept
     {
         mustRecreate = true;
     }
 };
 
+using GameWindow = BasicGameWindow<GameTimer>;
+
 } // namespace ssvs
@@ -0,0 +1,371 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include <SSVUtils/Core/Utils/Macros.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ssvs
+{
+
+class JobSystem;
+
+/// @brief Counts the unfinished jobs of a group. Pass it to
+/// `JobSystem::wait` to join the group.
+class JobCounter
+{
+    friend JobSystem;
+
+private:
+    std::atomic<std::size_t> count{0};
+
+public:
+    JobCounter() = default;
+
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    [[nodiscard]] bool isDone() const noexcept
+    {
+        return count.load(std::memory_order_acquire) == 0;
+    }
+};
+
+/// @brief Work-stealing thread pool.
+/// @details Every worker owns a deque: it pops its own jobs LIFO and steals
+/// from the others FIFO. Threads that are not workers push into a shared
+/// queue. Threads waiting on a `JobCounter` execute pending jobs instead of
+/// blocking, so jobs can submit and wait on other jobs. Workers are started
+/// on the first submission. Jobs must not throw.
+class JobSystem
+{
+private:
+    struct Job
+    {
+        std::function<void()> fn;
+        JobCounter* counter;
+    };
+
+    struct Queue
+    {
+        std::mutex mutex;
+        std::deque<Job> jobs;
+    };
+
+    static inline thread_local const JobSystem* tlsOwner{nullptr};
+    static inline thread_local std::size_t tlsIdx{0};
+
+    std::vector<std::thread> threads;
+    std::unique_ptr<Queue[]> queues;
+    std::size_t threadCount;
+    std::atomic<std::size_t> queued{0};
+    std::mutex sleepMutex;
+    std::condition_variable sleepCv;
+    std::once_flag startFlag;
+    bool exiting{false};
+
+    // Queue 0 is shared by all the threads that are not workers.
+    [[nodiscard]] std::size_t getLocalIdx() const noexcept
+    {
+        return tlsOwner == this ? tlsIdx : 0;
+    }
+
+    void start()
+    {
+        queues = std::make_unique<Queue[]>(threadCount + 1);
+
+        threads.reserve(threadCount);
+        for(std::size_t i{1}; i <= threadCount; ++i)
+            threads.emplace_back([this, i] { workerLoop(i); });
+    }
+
+    void push(Job&& mJob)
+    {
+        std::call_once(startFlag, [this] { start(); });
+
+        auto& q(queues[getLocalIdx()]);
+        {
+            std::lock_guard<std::mutex> lock{q.mutex};
+            q.jobs.emplace_back(std::move(mJob));
+        }
+
+        queued.fetch_add(1, std::memory_order_release);
+
+        // Taking the lock orders the push against a worker checking the
+        // sleep predicate, so the wake-up cannot be lost.
+        {
+            std::lock_guard<std::mutex> lock{sleepMutex};
+        }
+        sleepCv.notify_one();
+    }
+
+    [[nodiscard]] bool tryPop(std::size_t mIdx, Job& mJob)
+    {
+        if(queued.load(std::memory_order_acquire) == 0) return false;
+
+        {
+            auto& q(queues[mIdx]);
+            std::lock_guard<std::mutex> lock{q.mutex};
+
+            if(!q.jobs.empty())
+            {
+                mJob = std::move(q.jobs.back());
+                q.jobs.pop_back();
+                queued.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        for(std::size_t i{1}; i <= threadCount; ++i)
+        {
+            auto& q(queues[(mIdx + i) % (threadCount + 1)]);
+            std::lock_guard<std::mutex> lock{q.mutex};
+
+            if(!q.jobs.empty())
+            {
+                mJob = std::move(q.jobs.front());
+                q.jobs.pop_front();
+                queued.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static void execute(Job& mJob)
+    {
+        mJob.fn();
+        if(mJob.counter != nullptr)
+            mJob.counter->count.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    void workerLoop(std::size_t mIdx)
+    {
+        tlsOwner = this;
+        tlsIdx = mIdx;
+
+        Job job;
+
+        while(true)
+        {
+            if(tryPop(mIdx, job))
+            {
+                execute(job);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock{sleepMutex};
+            sleepCv.wait(lock, [this] {
+                return exiting || queued.load(std::memory_order_acquire) > 0;
+            });
+
+            if(exiting) break;
+        }
+    }
+
+public:
+    /// @param mThreadCount Number of worker threads. Zero uses one less than
+    /// the number of hardware threads, since the thread calling `wait` also
+    /// executes jobs.
+    JobSystem(std::size_t mThreadCount = 0)
+        : threadCount{mThreadCount != 0
+                          ? mThreadCount
+                          : std::max(std::thread::hardware_concurrency(), 2u) -
+                                1}
+    {
+    }
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    ~JobSystem()
+    {
+        {
+            std::lock_guard<std::mutex> lock{sleepMutex};
+            exiting = true;
+        }
+
+        sleepCv.notify_all();
+        for(auto& t : threads) t.join();
+    }
+
+    /// @brief Queues `mF` as part of the group counted by `mCounter`.
+    template <typename TF>
+    void submit(TF&& mF, JobCounter& mCounter)
+    {
+        mCounter.count.fetch_add(1, std::memory_order_relaxed);
+        push({FWD(mF), &mCounter});
+    }
+
+    /// @brief Queues `mF` without tracking its completion.
+    template <typename TF>
+    void submit(TF&& mF)
+    {
+        push({FWD(mF), nullptr});
+    }
+
+    /// @brief Executes pending jobs until every job of `mCounter`'s group has
+    /// finished.
+    void wait(const JobCounter& mCounter)
+    {
+        if(mCounter.isDone()) return;
+
+        const auto idx(getLocalIdx());
+        Job job;
+
+        while(!mCounter.isDone())
+        {
+            if(tryPop(idx, job))
+            {
+                execute(job);
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    /// @brief Calls `mF(i)` for every `i` in [`mBegin`, `mEnd`), split into
+    /// chunks of `mGrain` indices, and waits for all of them.
+    /// @param mGrain Chunk size. Zero picks about four chunks per thread.
+    template <typename TF>
+    void parallelFor(
+        std::size_t mBegin, std::size_t mEnd, TF&& mF, std::size_t mGrain = 0)
+    {
+        if(mBegin >= mEnd) return;
+
+        const auto count(mEnd - mBegin);
+        const auto grain(mGrain != 0
+                             ? mGrain
+                             : std::max(count / ((threadCount + 1) * 4),
+                                   std::size_t(1)));
+
+        JobCounter counter;
+
+        for(auto first(mBegin); first < mEnd; first += grain)
+        {
+            const auto last(std::min(first + grain, mEnd));
+            submit(
+                [&mF, first, last] {
+                    for(auto i(first); i < last; ++i) mF(i);
+                },
+                counter);
+        }
+
+        wait(counter);
+    }
+
+    [[nodiscard]] std::size_t getThreadCount() const noexcept
+    {
+        return threadCount;
+    }
+};
+
+/// @brief Set of tasks with dependencies, executed on a `JobSystem`.
+/// @details A task starts once all of its dependencies have finished.
+/// Independent tasks run in parallel. The graph must be acyclic.
+class TaskGraph
+{
+public:
+    using TaskId = std::size_t;
+
+private:
+    struct Node
+    {
+        std::function<void()> fn;
+        std::vector<TaskId> successors;
+        std::size_t dependencies{0};
+        std::atomic<std::size_t> remaining{0};
+
+        Node(std::function<void()>&& mFn) : fn{std::move(mFn)}
+        {
+        }
+    };
+
+    std::deque<Node> nodes;
+
+    void schedule(JobSystem& mJobs, JobCounter& mCounter, TaskId mId)
+    {
+        mJobs.submit(
+            [this, &mJobs, &mCounter, mId] {
+                auto& node(nodes[mId]);
+                node.fn();
+
+                for(const auto s : node.successors)
+                    if(nodes[s].remaining.fetch_sub(
+                           1, std::memory_order_acq_rel) == 1)
+                        schedule(mJobs, mCounter, s);
+            },
+            mCounter);
+    }
+
+public:
+    template <typename TF>
+    TaskId add(TF&& mF)
+    {
+        nodes.emplace_back(std::function<void()>{FWD(mF)});
+        return nodes.size() - 1;
+    }
+
+    /// @brief Adds a task that starts after all of `mDependencies`.
+    template <typename TF>
+    TaskId add(TF&& mF, std::initializer_list<TaskId> mDependencies)
+    {
+        const auto id(add(FWD(mF)));
+        for(const auto d : mDependencies) precede(d, id);
+
+        return id;
+    }
+
+    /// @brief Makes `mAfter` start only once `mBefore` has finished.
+    void precede(TaskId mBefore, TaskId mAfter)
+    {
+        assert(mBefore < nodes.size() && mAfter < nodes.size());
+
+        nodes[mBefore].successors.emplace_back(mAfter);
+        ++nodes[mAfter].dependencies;
+    }
+
+    /// @brief Runs every task and waits for all of them. The graph can be
+    /// run again afterwards.
+    void run(JobSystem& mJobs)
+    {
+        for(auto& n : nodes)
+            n.remaining.store(n.dependencies, std::memory_order_relaxed);
+
+        JobCounter counter;
+
+        for(TaskId i{0}; i < nodes.size(); ++i)
+            if(nodes[i].dependencies == 0) schedule(mJobs, counter, i);
+
+        mJobs.wait(counter);
+    }
+
+    void clear() noexcept
+    {
+        nodes.clear();
+    }
+
+    [[nodiscard]] std::size_t getSize() const noexcept
+    {
+        return nodes.size();
+    }
+};
+
+} // namespace ssvs
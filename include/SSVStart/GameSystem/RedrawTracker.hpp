@@ -0,0 +1,66 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include <cstddef>
+
+namespace ssvs
+{
+
+/// @brief Decides which frames are redrawn in retained mode, where a frame
+/// is only redrawn if something changed since the last one.
+class RedrawTracker
+{
+private:
+    std::size_t skippedFrames{0};
+    bool enabled{false}, invalidated{true};
+
+public:
+    /// @brief Enables retained mode. The next frame is always redrawn.
+    void setEnabled(bool mEnabled) noexcept
+    {
+        enabled = mEnabled;
+        invalidated = true;
+    }
+
+    /// @brief Forces the next frame to be redrawn.
+    void invalidate() noexcept
+    {
+        invalidated = true;
+    }
+
+    /// @brief Returns whether the current frame must be redrawn. `mChanged`
+    /// tells if the frame changed anything on its own, e.g. if an update
+    /// tick ran. Frames that are not redrawn are counted as skipped.
+    [[nodiscard]] bool beginFrame(bool mChanged) noexcept
+    {
+        if(!enabled || mChanged || invalidated)
+        {
+            invalidated = false;
+            return true;
+        }
+
+        ++skippedFrames;
+        return false;
+    }
+
+    [[nodiscard]] bool isEnabled() const noexcept
+    {
+        return enabled;
+    }
+
+    [[nodiscard]] bool isInvalidated() const noexcept
+    {
+        return invalidated;
+    }
+
+    /// @brief Returns the number of frames not redrawn.
+    [[nodiscard]] std::size_t getSkippedFrames() const noexcept
+    {
+        return skippedFrames;
+    }
+};
+
+} // namespace ssvs
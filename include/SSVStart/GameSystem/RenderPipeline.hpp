@@ -0,0 +1,175 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include "SSVStart/Global/Typedefs.hpp"
+#include "SSVStart/GameSystem/DrawList.hpp"
+
+#include <SFML/Graphics/RenderWindow.hpp>
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ssvs
+{
+
+/// @brief Double-buffered draw lists submitted by a dedicated render thread,
+/// which owns the window's GL context while running.
+/// @details The main thread records frame N+1 while the render thread
+/// submits and displays frame N. Each frame carries its own draw list and
+/// render thread tasks.
+template <typename TWindow = sf::RenderWindow>
+class BasicRenderPipeline
+{
+private:
+    using Task = std::function<void(TWindow&)>;
+
+    struct Frame
+    {
+        DrawList drawList;
+        std::vector<Task> tasks;
+
+        void reset() noexcept
+        {
+            drawList.reset();
+            tasks.clear();
+        }
+    };
+
+    TWindow& renderWindow;
+    std::array<Frame, 2> frames;
+    std::size_t recordIdx{0};
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool pending{false}, exiting{false};
+
+    void threadLoop()
+    {
+        renderWindow.setActive(true);
+
+        while(true)
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            cv.wait(lock, [this] { return pending || exiting; });
+
+            if(!pending) break;
+
+            // The main thread does not touch the submitted frame until
+            // `pending` is reset.
+            auto& frame(frames[1 - recordIdx]);
+            lock.unlock();
+
+            frame.drawList.submit(renderWindow);
+            for(auto& t : frame.tasks) t(renderWindow);
+
+            renderWindow.display();
+
+            lock.lock();
+            pending = false;
+            lock.unlock();
+
+            cv.notify_all();
+        }
+
+        renderWindow.setActive(false);
+    }
+
+public:
+    BasicRenderPipeline(TWindow& mRenderWindow) noexcept
+        : renderWindow(mRenderWindow)
+    {
+    }
+
+    BasicRenderPipeline(const BasicRenderPipeline&) = delete;
+    BasicRenderPipeline& operator=(const BasicRenderPipeline&) = delete;
+
+    ~BasicRenderPipeline()
+    {
+        stop();
+    }
+
+    /// @brief Releases the window's context on the calling thread and starts
+    /// the render thread.
+    void start()
+    {
+        if(isRunning()) return;
+
+        renderWindow.setActive(false);
+
+        exiting = pending = false;
+        frames[0].reset();
+        frames[1].reset();
+
+        thread = std::thread{[this] { threadLoop(); }};
+    }
+
+    /// @brief Submits the last handed-over frame, then joins the render
+    /// thread. The window's context is left inactive.
+    void stop()
+    {
+        if(!isRunning()) return;
+
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            exiting = true;
+        }
+
+        cv.notify_all();
+        thread.join();
+    }
+
+    /// @brief Hands the recorded draw list over to the render thread and
+    /// returns an empty one for the next frame. Blocks until the previous
+    /// frame has been displayed.
+    void present()
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        cv.wait(lock, [this] { return !pending; });
+
+        recordIdx = 1 - recordIdx;
+        frames[recordIdx].reset();
+        pending = true;
+        lock.unlock();
+
+        cv.notify_all();
+    }
+
+    /// @brief Blocks until the render thread has displayed every handed-over
+    /// frame.
+    void waitIdle()
+    {
+        std::unique_lock<std::mutex> lock{mutex};
+        cv.wait(lock, [this] { return !pending; });
+    }
+
+    /// @brief Runs `mTask` on the render thread after the frame being
+    /// recorded has been submitted, before it is displayed.
+    template <typename TF>
+    void post(TF&& mTask)
+    {
+        frames[recordIdx].tasks.emplace_back(FWD(mTask));
+    }
+
+    [[nodiscard]] DrawList& getRecordList() noexcept
+    {
+        return frames[recordIdx].drawList;
+    }
+
+    [[nodiscard]] bool isRunning() const noexcept
+    {
+        return thread.joinable();
+    }
+};
+
+using RenderPipeline = BasicRenderPipeline<>;
+
+} // namespace ssvs
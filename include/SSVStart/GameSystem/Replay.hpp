@@ -0,0 +1,309 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include "SSVStart/Global/Typedefs.hpp"
+#include "SSVStart/Input/InputState.hpp"
+
+#include <SFML/Window/Event.hpp>
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace ssvs
+{
+
+namespace Impl
+{
+    inline constexpr char replayMagic[4]{'S', 'S', 'V', 'R'};
+    inline constexpr std::uint8_t replayVersion{1};
+
+    enum ReplayFlags : std::uint8_t
+    {
+        InputChanged = 1 << 0,
+        HasEvents = 1 << 1
+    };
+
+    /// @brief Returns the number of bytes of the event's union that are
+    /// meaningful for its type.
+    [[nodiscard]] inline std::size_t getEventPayloadSize(
+        sf::Event::EventType mType) noexcept
+    {
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+        switch(mType)
+        {
+            case sf::Event::Closed:
+            case sf::Event::LostFocus:
+            case sf::Event::GainedFocus:
+            case sf::Event::MouseEntered:
+            case sf::Event::MouseLeft: return 0;
+            case sf::Event::Resized: return sizeof(sf::Event::SizeEvent);
+            case sf::Event::KeyPressed:
+            case sf::Event::KeyReleased: return sizeof(sf::Event::KeyEvent);
+            case sf::Event::TextEntered: return sizeof(sf::Event::TextEvent);
+            case sf::Event::MouseMoved:
+                return sizeof(sf::Event::MouseMoveEvent);
+            case sf::Event::MouseButtonPressed:
+            case sf::Event::MouseButtonReleased:
+                return sizeof(sf::Event::MouseButtonEvent);
+            case sf::Event::MouseWheelScrolled:
+                return sizeof(sf::Event::MouseWheelScrollEvent);
+            case sf::Event::TouchBegan:
+            case sf::Event::TouchMoved:
+            case sf::Event::TouchEnded: return sizeof(sf::Event::TouchEvent);
+            default: return sizeof(sf::Event) - sizeof(sf::Event::EventType);
+        }
+#pragma GCC diagnostic pop
+    }
+
+    template <typename T>
+    void writeRaw(std::ostream& mStream, const T& mX)
+    {
+        mStream.write(reinterpret_cast<const char*>(&mX), sizeof(T));
+    }
+
+    template <typename T>
+    [[nodiscard]] bool readRaw(std::istream& mStream, T& mX)
+    {
+        return static_cast<bool>(
+            mStream.read(reinterpret_cast<char*>(&mX), sizeof(T)));
+    }
+
+    template <std::size_t TN>
+    void writeBitset(std::ostream& mStream, const std::bitset<TN>& mBitset)
+    {
+        for(std::size_t i{0}; i < TN; i += 8)
+        {
+            std::uint8_t byte{0};
+            for(std::size_t j{0}; j < 8 && i + j < TN; ++j)
+                if(mBitset[i + j]) byte |= std::uint8_t(1u << j);
+
+            writeRaw(mStream, byte);
+        }
+    }
+
+    template <std::size_t TN>
+    [[nodiscard]] bool readBitset(
+        std::istream& mStream, std::bitset<TN>& mBitset)
+    {
+        for(std::size_t i{0}; i < TN; i += 8)
+        {
+            std::uint8_t byte;
+            if(!readRaw(mStream, byte)) return false;
+
+            for(std::size_t j{0}; j < 8 && i + j < TN; ++j)
+                mBitset[i + j] = (byte >> j) & 1u;
+        }
+
+        return true;
+    }
+} // namespace Impl
+
+/// @brief Input and timing data of a single recorded frame.
+struct ReplayFrame
+{
+    FT frameTime{0};
+    Input::InputState inputState;
+    std::vector<sf::Event> events;
+};
+
+/// @brief Streams per-frame input states, events and frame times into a
+/// compact binary log.
+/// @details Each frame stores its frame time, the input bitsets only when
+/// they changed since the previous frame, and the meaningful bytes of every
+/// event dispatched to the game state. Values are written in the host's byte
+/// order.
+class ReplayRecorder
+{
+private:
+    std::ostream& stream;
+    Input::InputState lastInputState;
+    std::vector<sf::Event> events;
+    std::size_t frames{0};
+    bool first{true};
+
+    [[nodiscard]] bool hasInputChanged(
+        const Input::InputState& mInputState) const noexcept
+    {
+        return first || mInputState.getKeys() != lastInputState.getKeys() ||
+               mInputState.getBtns() != lastInputState.getBtns() ||
+               mInputState.getFingers() != lastInputState.getFingers();
+    }
+
+public:
+    ReplayRecorder(std::ostream& mStream) : stream(mStream)
+    {
+        stream.write(Impl::replayMagic, sizeof(Impl::replayMagic));
+        Impl::writeRaw(stream, Impl::replayVersion);
+        Impl::writeRaw(stream, std::uint16_t(kKeyCount));
+        Impl::writeRaw(stream, std::uint8_t(mBtnCount));
+        Impl::writeRaw(stream, std::uint8_t(fingerCount));
+    }
+
+    ReplayRecorder(const ReplayRecorder&) = delete;
+    ReplayRecorder& operator=(const ReplayRecorder&) = delete;
+
+    /// @brief Buffers an event dispatched during the current frame.
+    void recordEvent(const sf::Event& mEvent)
+    {
+        events.emplace_back(mEvent);
+    }
+
+    /// @brief Writes the current frame to the stream.
+    /// @param mFrameTime Frame time the simulation will run with.
+    /// @param mInputState Input state after all of the frame's events.
+    void endFrame(FT mFrameTime, const Input::InputState& mInputState)
+    {
+        const bool inputChanged(hasInputChanged(mInputState));
+
+        std::uint8_t flags{0};
+        if(inputChanged) flags |= Impl::InputChanged;
+        if(!events.empty()) flags |= Impl::HasEvents;
+
+        Impl::writeRaw(stream, flags);
+        Impl::writeRaw(stream, mFrameTime);
+
+        if(inputChanged)
+        {
+            Impl::writeBitset(stream, mInputState.getKeys());
+            Impl::writeBitset(stream, mInputState.getBtns());
+            Impl::writeBitset(stream, mInputState.getFingers());
+
+            lastInputState = mInputState;
+            first = false;
+        }
+
+        if(!events.empty())
+        {
+            Impl::writeRaw(stream, std::uint32_t(events.size()));
+
+            for(const auto& e : events)
+            {
+                Impl::writeRaw(stream, std::uint8_t(e.type));
+                stream.write(reinterpret_cast<const char*>(&e.size),
+                    Impl::getEventPayloadSize(e.type));
+            }
+
+            events.clear();
+        }
+
+        ++frames;
+    }
+
+    void flush()
+    {
+        stream.flush();
+    }
+
+    [[nodiscard]] std::size_t getFrames() const noexcept
+    {
+        return frames;
+    }
+};
+
+/// @brief Reads back a log written by `ReplayRecorder`.
+class ReplayPlayer
+{
+private:
+    std::istream& stream;
+    Input::InputState inputState;
+    std::size_t frames{0};
+    bool valid{false};
+
+    [[nodiscard]] bool readHeader()
+    {
+        char magic[sizeof(Impl::replayMagic)];
+        std::uint8_t version, btns, fingers;
+        std::uint16_t keys;
+
+        if(!stream.read(magic, sizeof(magic))) return false;
+
+        for(std::size_t i{0}; i < sizeof(magic); ++i)
+            if(magic[i] != Impl::replayMagic[i]) return false;
+
+        return Impl::readRaw(stream, version) &&
+               version == Impl::replayVersion &&
+               Impl::readRaw(stream, keys) && keys == kKeyCount &&
+               Impl::readRaw(stream, btns) && btns == mBtnCount &&
+               Impl::readRaw(stream, fingers) && fingers == fingerCount;
+    }
+
+public:
+    ReplayPlayer(std::istream& mStream) : stream(mStream)
+    {
+        valid = readHeader();
+    }
+
+    ReplayPlayer(const ReplayPlayer&) = delete;
+    ReplayPlayer& operator=(const ReplayPlayer&) = delete;
+
+    /// @brief Reads the next frame into `mFrame`, reusing its event storage.
+    /// @return Returns false at the end of the log, or if it is malformed.
+    [[nodiscard]] bool readFrame(ReplayFrame& mFrame)
+    {
+        using Traits = std::istream::traits_type;
+        if(!valid || stream.peek() == Traits::eof()) return false;
+
+        std::uint8_t flags;
+        if(!Impl::readRaw(stream, flags) ||
+            !Impl::readRaw(stream, mFrame.frameTime))
+            return valid = false;
+
+        if(flags & Impl::InputChanged)
+        {
+            if(!Impl::readBitset(stream, inputState.getKeys()) ||
+                !Impl::readBitset(stream, inputState.getBtns()) ||
+                !Impl::readBitset(stream, inputState.getFingers()))
+                return valid = false;
+        }
+
+        mFrame.inputState = inputState;
+        mFrame.events.clear();
+
+        if(flags & Impl::HasEvents)
+        {
+            std::uint32_t count;
+            if(!Impl::readRaw(stream, count)) return valid = false;
+
+            for(std::uint32_t i{0}; i < count; ++i)
+            {
+                std::uint8_t type;
+                if(!Impl::readRaw(stream, type) || type >= sf::Event::Count)
+                    return valid = false;
+
+                sf::Event e{};
+                e.type = static_cast<sf::Event::EventType>(type);
+
+                if(!stream.read(reinterpret_cast<char*>(&e.size),
+                       Impl::getEventPayloadSize(e.type)))
+                    return valid = false;
+
+                mFrame.events.emplace_back(e);
+            }
+        }
+
+        ++frames;
+        return true;
+    }
+
+    /// @brief Returns false if the header did not match, or if a malformed
+    /// frame was read.
+    [[nodiscard]] bool isValid() const noexcept
+    {
+        return valid;
+    }
+
+    [[nodiscard]] std::size_t getFrames() const noexcept
+    {
+        return frames;
+    }
+};
+
+} // namespace ssvs
@@ -11,18 +11,18 @@
 namespace ssvs
 {
 
-class GameEngine;
+class GameEngineBase;
 
 class TimerBase
 {
 protected:
-    GameEngine& gameEngine;
+    GameEngineBase& gameEngine;
     sf::Clock clock;
     ssvu::FT frameTime{0};
     float fps{0};
 
 public:
-    TimerBase(GameEngine& mGameEngine) noexcept : gameEngine(mGameEngine)
+    TimerBase(GameEngineBase& mGameEngine) noexcept : gameEngine(mGameEngine)
     {
     }
 
@@ -48,6 +48,19 @@ public:
 
     virtual void runDraw() final;
 
+    /// @brief Restarts the frame time measurement from now, e.g. after the
+    /// loop was blocked for a while.
+    void restartClock() noexcept
+    {
+        clock.restart();
+    }
+
+    /// @brief Overrides the measured frame time, e.g. with a synthetic one.
+    void setFrameTime(ssvu::FT mFrameTime) noexcept
+    {
+        frameTime = mFrameTime;
+    }
+
     [[nodiscard]] ssvu::FT getFrameTime() const noexcept
     {
         return frameTime;
@@ -57,6 +70,13 @@ public:
     {
         return fps;
     }
+
+    /// @brief Returns how far the current frame is between the previous and
+    /// the next simulation tick, in the [0, 1] range.
+    [[nodiscard]] virtual float getInterpolation() const noexcept
+    {
+        return 1.f;
+    }
 };
 
 } // namespace ssvs
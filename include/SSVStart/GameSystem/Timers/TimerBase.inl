@@ -9,7 +9,7 @@ namespace ssvs
 
 inline void TimerBase::runDraw()
 {
-    gameEngine.drawFromTimer();
+    gameEngine.drawFromTimer(getInterpolation());
 }
 
 } // namespace ssvs
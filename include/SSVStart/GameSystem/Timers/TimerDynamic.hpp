@@ -5,7 +5,7 @@
 #pragma once
 
 #include "SSVStart/GameSystem/Timers/TimerBase.hpp"
-#include "SSVStart/GameSystem/GameEngine.hpp"
+#include "SSVStart/GameSystem/GameEngineBase.hpp"
 
 #include <SSVUtils/Core/Common/Frametime.hpp>
 #include <SSVUtils/Core/Utils/Math.hpp>
@@ -19,7 +19,7 @@ private:
     ssvu::FT frameTimeLimit{4.f};
 
 public:
-    TimerDynamic(GameEngine& mGameEngine) noexcept : TimerBase(mGameEngine)
+    TimerDynamic(GameEngineBase& mGameEngine) noexcept : TimerBase(mGameEngine)
     {
     }
 
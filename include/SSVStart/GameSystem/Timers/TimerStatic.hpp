@@ -5,43 +5,97 @@
 #pragma once
 
 #include "SSVStart/GameSystem/Timers/TimerBase.hpp"
-#include "SSVStart/GameSystem/GameEngine.hpp"
+#include "SSVStart/GameSystem/GameEngineBase.hpp"
 
 #include <SSVUtils/Core/Common/Frametime.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
 namespace ssvs
 {
 
 class TimerStatic final : public TimerBase
 {
 private:
+    using Clock = std::chrono::steady_clock;
+
     ssvu::FT step, timeSlice, time{0};
-    float maxLoops, loops{0};
+    ssvu::FT droppedTime{0}, lastDroppedTime{0};
+    float maxLoops, loops{0}, adaptiveMaxLoops;
+    float frameBudgetMs{0.f}, tickCostMs{0.f};
+
+    [[nodiscard]] bool isAdaptive() const noexcept
+    {
+        return frameBudgetMs > 0.f;
+    }
+
+    void adapt(Clock::duration mElapsed) noexcept
+    {
+        const auto costMs(ssvu::FTDuration(mElapsed).count() / loops);
+
+        // Exponential moving average, seeded with the first sample.
+        tickCostMs = tickCostMs == 0.f
+                         ? costMs
+                         : tickCostMs + (costMs - tickCostMs) * 0.1f;
+
+        adaptiveMaxLoops = tickCostMs > 0.f
+                               ? std::floor(frameBudgetMs / tickCostMs)
+                               : maxLoops;
+
+        adaptiveMaxLoops = std::clamp(adaptiveMaxLoops, 1.f, maxLoops);
+    }
+
+    void dropBacklog() noexcept
+    {
+        if(time < timeSlice) return;
+
+        // Keep the fractional part of a slice, so that the interpolation
+        // factor stays meaningful.
+        const auto kept(std::fmod(time, timeSlice));
+        lastDroppedTime = time - kept;
+        droppedTime += lastDroppedTime;
+        time = kept;
+    }
 
 public:
-    TimerStatic(GameEngine& mGameEngine, ssvu::FT mStep = 1.f,
+    TimerStatic(GameEngineBase& mGameEngine, ssvu::FT mStep = 1.f,
         ssvu::FT mTimeSlice = 1.f, float mMaxLoops = 50.f) noexcept
         : TimerBase(mGameEngine), step{mStep}, timeSlice{mTimeSlice},
-          maxLoops{mMaxLoops}
+          maxLoops{mMaxLoops}, adaptiveMaxLoops{mMaxLoops}
     {
     }
 
+    /// @brief Restarts the accumulated time and the adaptation of the tick
+    /// limit to the measured tick cost.
     void reset() override
     {
-        time = loops = 0;
+        time = loops = lastDroppedTime = 0;
+        tickCostMs = 0.f;
+        adaptiveMaxLoops = maxLoops;
     }
 
     void runUpdate() override
     {
         loops = 0;
+        lastDroppedTime = 0;
         time += frameTime;
 
-        while(time >= timeSlice && loops < maxLoops)
+        const auto loopLimit(isAdaptive() ? adaptiveMaxLoops : maxLoops);
+        const auto start(isAdaptive() ? Clock::now() : Clock::time_point{});
+
+        while(time >= timeSlice && loops < loopLimit)
         {
             gameEngine.updateFromTimer(step);
             time -= timeSlice;
             ++loops;
         }
+
+        if(!isAdaptive()) return;
+
+        if(loops > 0) adapt(Clock::now() - start);
+        dropBacklog();
     }
 
     void setStep(ssvu::FT mStep) noexcept
@@ -57,6 +111,18 @@ public:
     void setMaxLoops(float mMaxLoops) noexcept
     {
         maxLoops = mMaxLoops;
+        adaptiveMaxLoops = std::min(adaptiveMaxLoops, maxLoops);
+    }
+
+    /// @brief Enables spiral-of-death protection: the number of ticks per
+    /// frame is adapted so that their measured cost stays within
+    /// `mBudgetMs`, and simulated time that cannot be caught up is dropped.
+    /// A budget of zero (the default) disables adaptation.
+    void setFrameBudget(float mBudgetMs) noexcept
+    {
+        frameBudgetMs = mBudgetMs;
+        adaptiveMaxLoops = maxLoops;
+        tickCostMs = 0.f;
     }
 
     [[nodiscard]] ssvu::FT getStep() const noexcept
@@ -83,6 +149,47 @@ public:
     {
         return loops;
     }
+
+    [[nodiscard]] float getFrameBudget() const noexcept
+    {
+        return frameBudgetMs;
+    }
+
+    /// @brief Returns the current adapted limit of ticks per frame.
+    [[nodiscard]] float getAdaptiveMaxLoops() const noexcept
+    {
+        return isAdaptive() ? adaptiveMaxLoops : maxLoops;
+    }
+
+    /// @brief Returns the moving average of the cost of a tick, in ms.
+    [[nodiscard]] float getTickCost() const noexcept
+    {
+        return tickCostMs;
+    }
+
+    /// @brief Returns the total simulated time dropped so far.
+    [[nodiscard]] ssvu::FT getDroppedTime() const noexcept
+    {
+        return droppedTime;
+    }
+
+    /// @brief Returns the simulated time dropped during the last update.
+    [[nodiscard]] ssvu::FT getLastDroppedTime() const noexcept
+    {
+        return lastDroppedTime;
+    }
+
+    void resetDroppedTime() noexcept
+    {
+        droppedTime = 0;
+    }
+
+    /// @brief Returns the leftover accumulated time normalized by the time
+    /// slice, to interpolate between the last two simulation ticks.
+    [[nodiscard]] float getInterpolation() const noexcept override
+    {
+        return std::clamp(time / timeSlice, 0.f, 1.f);
+    }
 };
 
 } // namespace ssvs
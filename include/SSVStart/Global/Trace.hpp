@@ -0,0 +1,329 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+namespace ssvs
+{
+
+namespace Trace
+{
+    struct Event
+    {
+        const char* name;
+        std::int64_t beginNs, endNs;
+    };
+
+    namespace Impl
+    {
+        struct ThreadBuffer
+        {
+            // Only accessed by the owning thread.
+            std::vector<Event> pending;
+
+            // Guarded by `mutex`.
+            std::mutex mutex;
+            std::vector<Event> events;
+            std::size_t dropped{0};
+
+            std::uint32_t tid;
+        };
+
+        inline void writeEscaped(std::ostream& mStream, const char* mStr)
+        {
+            for(; *mStr != '\0'; ++mStr)
+            {
+                if(*mStr == '"' || *mStr == '\\') mStream << '\\';
+                mStream << *mStr;
+            }
+        }
+    } // namespace Impl
+
+    /// @brief Collects scoped timing events from every thread into per-thread
+    /// buffers, and exports them as Chrome trace JSON.
+    /// @details Recording is off until `start` is called. While off, a scope
+    /// costs a single relaxed atomic load. While on, events are appended to
+    /// a buffer only the recording thread touches, and published in batches:
+    /// when the thread's outermost scope ends, when `batchSize` events are
+    /// pending, when the thread exits, or when it calls `flush`. Only
+    /// registering a thread and publishing take locks.
+    class Tracer
+    {
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        static constexpr std::size_t batchSize{1024};
+
+        /// @brief Publishes the buffer of the thread it belongs to on exit.
+        struct LocalBuffer
+        {
+            std::shared_ptr<Impl::ThreadBuffer> buffer;
+
+            ~LocalBuffer()
+            {
+                if(buffer != nullptr) Tracer::get().publish(*buffer);
+            }
+        };
+
+        std::mutex mutex;
+        std::vector<std::shared_ptr<Impl::ThreadBuffer>> buffers;
+        std::atomic<bool> recording{false};
+        std::atomic<std::size_t> maxEventsPerThread{1u << 20};
+        std::atomic<std::int64_t> clearedAtNs{0};
+        Clock::time_point epoch{Clock::now()};
+
+        [[nodiscard]] Impl::ThreadBuffer& getLocalBuffer()
+        {
+            // The registry keeps buffers alive after their thread exits.
+            thread_local LocalBuffer local;
+
+            if(local.buffer == nullptr)
+            {
+                local.buffer = std::make_shared<Impl::ThreadBuffer>();
+                local.buffer->pending.reserve(batchSize);
+
+                std::lock_guard<std::mutex> lock{mutex};
+                local.buffer->tid = static_cast<std::uint32_t>(buffers.size());
+                buffers.emplace_back(local.buffer);
+            }
+
+            return *local.buffer;
+        }
+
+        // Called by the thread owning `mBuffer`.
+        void publish(Impl::ThreadBuffer& mBuffer)
+        {
+            if(mBuffer.pending.empty()) return;
+
+            const auto max(maxEventsPerThread.load(std::memory_order_relaxed));
+            const auto clearedAt(clearedAtNs.load(std::memory_order_relaxed));
+
+            {
+                std::lock_guard<std::mutex> lock{mBuffer.mutex};
+
+                for(const auto& e : mBuffer.pending)
+                {
+                    // Skip events that began before the last `clear`.
+                    if(e.beginNs < clearedAt) continue;
+
+                    if(mBuffer.events.size() >= max)
+                        ++mBuffer.dropped;
+                    else
+                        mBuffer.events.push_back(e);
+                }
+            }
+
+            mBuffer.pending.clear();
+        }
+
+    public:
+        [[nodiscard]] static Tracer& get()
+        {
+            static Tracer instance;
+            return instance;
+        }
+
+        void start() noexcept
+        {
+            recording.store(true, std::memory_order_relaxed);
+        }
+
+        void stop() noexcept
+        {
+            recording.store(false, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] bool isRecording() const noexcept
+        {
+            return recording.load(std::memory_order_relaxed);
+        }
+
+        /// @brief Sets the number of events kept per thread. Events beyond
+        /// it are dropped.
+        void setMaxEventsPerThread(std::size_t mMax) noexcept
+        {
+            maxEventsPerThread.store(mMax, std::memory_order_relaxed);
+        }
+
+        [[nodiscard]] std::int64_t now() const noexcept
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                Clock::now() - epoch)
+                .count();
+        }
+
+        /// @brief Records a complete event. `mName` must outlive the tracer,
+        /// e.g. a string literal.
+        void record(const char* mName, std::int64_t mBeginNs,
+            std::int64_t mEndNs)
+        {
+            auto& b(getLocalBuffer());
+            b.pending.push_back({mName, mBeginNs, mEndNs});
+
+            if(b.pending.size() >= batchSize) publish(b);
+        }
+
+        /// @brief Publishes the events recorded by the calling thread, so
+        /// that they are visible to the other member functions.
+        void flush()
+        {
+            publish(getLocalBuffer());
+        }
+
+        /// @brief Discards every published event, and every pending event
+        /// that began before the call.
+        void clear()
+        {
+            clearedAtNs.store(now(), std::memory_order_relaxed);
+            flush();
+
+            std::lock_guard<std::mutex> lock{mutex};
+
+            for(auto& b : buffers)
+            {
+                std::lock_guard<std::mutex> bLock{b->mutex};
+                b->events.clear();
+                b->dropped = 0;
+            }
+        }
+
+        /// @brief Returns the number of published events, after publishing
+        /// the calling thread's.
+        [[nodiscard]] std::size_t getEventCount()
+        {
+            flush();
+            std::lock_guard<std::mutex> lock{mutex};
+
+            std::size_t result{0};
+            for(auto& b : buffers)
+            {
+                std::lock_guard<std::mutex> bLock{b->mutex};
+                result += b->events.size();
+            }
+
+            return result;
+        }
+
+        [[nodiscard]] std::size_t getDroppedCount()
+        {
+            flush();
+            std::lock_guard<std::mutex> lock{mutex};
+
+            std::size_t result{0};
+            for(auto& b : buffers)
+            {
+                std::lock_guard<std::mutex> bLock{b->mutex};
+                result += b->dropped;
+            }
+
+            return result;
+        }
+
+        /// @brief Writes every published event in the Chrome trace event
+        /// format, loadable by `chrome://tracing` and Perfetto.
+        void writeChromeTrace(std::ostream& mStream)
+        {
+            flush();
+            std::lock_guard<std::mutex> lock{mutex};
+            mStream << "{\"traceEvents\":[";
+            bool first{true};
+
+            for(auto& b : buffers)
+            {
+                std::lock_guard<std::mutex> bLock{b->mutex};
+
+                for(const auto& e : b->events)
+                {
+                    if(!first) mStream << ',';
+                    first = false;
+
+                    mStream << "\n{\"name\":\"";
+                    Impl::writeEscaped(mStream, e.name);
+                    mStream << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << b->tid
+                            << ",\"ts\":" << e.beginNs / 1000 << '.'
+                            << (e.beginNs % 1000) / 100
+                            << ",\"dur\":" << (e.endNs - e.beginNs) / 1000
+                            << '.' << ((e.endNs - e.beginNs) % 1000) / 100
+                            << '}';
+                }
+            }
+
+            mStream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        }
+    };
+
+    /// @brief Records the lifetime of the scope as an event, if the tracer is
+    /// recording when the scope is entered. The outermost recorded scope of
+    /// a thread publishes its events when it ends.
+    class Scope
+    {
+    private:
+        inline static thread_local std::size_t depth{0};
+
+        const char* name;
+        std::int64_t begin{-1};
+
+    public:
+        Scope(const char* mName) noexcept : name{mName}
+        {
+            auto& t(Tracer::get());
+            if(!t.isRecording()) return;
+
+            begin = t.now();
+            ++depth;
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        ~Scope()
+        {
+            if(begin < 0) return;
+
+            auto& t(Tracer::get());
+            t.record(name, begin, t.now());
+
+            if(--depth == 0) t.flush();
+        }
+    };
+} // namespace Trace
+
+} // namespace ssvs
+
+#define SSVS_IMPL_TRACE_CAT_IMPL(a, b) a##b
+#define SSVS_IMPL_TRACE_CAT(a, b) SSVS_IMPL_TRACE_CAT_IMPL(a, b)
+
+// `SSVS_ENABLE_PROFILING` must be defined for the whole program, e.g. with
+// the `SSVSTART_ENABLE_PROFILING` CMake option, and never in a source file:
+// the library's inline functions contain profiling scopes, so defining it
+// in only some translation units violates the one definition rule.
+#ifdef SSVS_ENABLE_PROFILING
+
+/// @brief Records the enclosing scope as a trace event named `mName`, which
+/// must be a string literal. Compiles to nothing unless
+/// `SSVS_ENABLE_PROFILING` is defined.
+#define SSVS_PROFILE_SCOPE(mName)                       \
+    const ::ssvs::Trace::Scope SSVS_IMPL_TRACE_CAT(     \
+        ssvsTraceScope, __LINE__)                       \
+    {                                                   \
+        mName                                           \
+    }
+
+#else
+
+#define SSVS_PROFILE_SCOPE(mName) \
+    do                            \
+    {                             \
+    } while(false)
+
+#endif
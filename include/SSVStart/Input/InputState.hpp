@@ -9,13 +9,15 @@
 
 namespace ssvs
 {
-    class GameWindow;
+    template <typename>
+    class BasicGameWindow;
 
     namespace Input
     {
         class InputState
         {
-            friend ssvs::GameWindow;
+            template <typename>
+            friend class ssvs::BasicGameWindow;
 
         private:
             FingerBitset fingers;
@@ -5,6 +5,8 @@
 #ifndef SSVS_INPUT_MANAGER
 #define SSVS_INPUT_MANAGER
 
+#include "SSVStart/Global/Trace.hpp"
+
 namespace ssvs
 {
     namespace Input
@@ -25,6 +27,8 @@ namespace ssvs
         public:
             inline void update(InputState& mInputState, FT mFT)
             {
+                SSVS_PROFILE_SCOPE("Input::Manager::update");
+
                 if(isIgnoringAll) return;
 
                 for(auto& b : binds)
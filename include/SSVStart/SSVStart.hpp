@@ -5,6 +5,7 @@
 #pragma once
 
 #include "SSVStart/Global/Typedefs.hpp"
+#include "SSVStart/Global/Trace.hpp"
 #include "SSVStart/Animation/Animation.hpp"
 #include "SSVStart/Assets/Assets.hpp"
 #include "SSVStart/BitmapText/BitmapText.hpp"
@@ -0,0 +1,169 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#pragma once
+
+#include "SSVStart/Global/Typedefs.hpp"
+
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+
+#include <cmath>
+#include <type_traits>
+
+namespace ssvs
+{
+
+/// @brief Linearly interpolates between two values.
+/// @param mPrev Value at the previous simulation tick.
+/// @param mCurr Value at the current simulation tick.
+/// @param mAlpha Interpolation factor, in the [0, 1] range.
+/// @details Integral values are interpolated in floating point, so that
+/// unsigned ones can decrease, and rounded to the nearest integer.
+template <typename T>
+[[nodiscard]] inline T getInterpolated(
+    const T& mPrev, const T& mCurr, float mAlpha) noexcept
+{
+    if constexpr(std::is_integral_v<T>)
+    {
+        const auto prev(static_cast<double>(mPrev));
+        return static_cast<T>(std::llround(
+            prev + (static_cast<double>(mCurr) - prev) * mAlpha));
+    }
+    else
+        return mPrev + (mCurr - mPrev) * mAlpha;
+}
+
+/// @brief Linearly interpolates between two vectors. The components of
+/// integral vectors are rounded to the nearest integer.
+template <typename T>
+[[nodiscard]] inline Vec2<T> getInterpolated(
+    const Vec2<T>& mPrev, const Vec2<T>& mCurr, float mAlpha) noexcept
+{
+    return {getInterpolated(mPrev.x, mCurr.x, mAlpha),
+        getInterpolated(mPrev.y, mCurr.y, mAlpha)};
+}
+
+/// @brief Interpolates between two angles in degrees, along the shortest
+/// arc.
+[[nodiscard]] inline float getInterpolatedDeg(
+    float mPrev, float mCurr, float mAlpha) noexcept
+{
+    return mPrev + std::remainder(mCurr - mPrev, 360.f) * mAlpha;
+}
+
+/// @brief Interpolates between two angles in radians, along the shortest
+/// arc.
+[[nodiscard]] inline float getInterpolatedRad(
+    float mPrev, float mCurr, float mAlpha) noexcept
+{
+    return mPrev + std::remainder(mCurr - mPrev, 6.28318530718f) * mAlpha;
+}
+
+/// @brief Value that remembers its state at the previous simulation tick.
+/// @details Call `push` once per tick with the new value and `get` while
+/// drawing with the timer's interpolation factor.
+template <typename T>
+class Interpolated
+{
+private:
+    T prev{}, curr{};
+
+public:
+    Interpolated() = default;
+    Interpolated(const T& mValue) : prev{mValue}, curr{mValue}
+    {
+    }
+
+    void push(const T& mValue)
+    {
+        prev = curr;
+        curr = mValue;
+    }
+
+    /// @brief Sets both states, skipping interpolation (e.g. teleports).
+    void snap(const T& mValue)
+    {
+        prev = curr = mValue;
+    }
+
+    [[nodiscard]] T get(float mAlpha) const noexcept
+    {
+        return getInterpolated(prev, curr, mAlpha);
+    }
+
+    [[nodiscard]] const T& getPrev() const noexcept
+    {
+        return prev;
+    }
+
+    [[nodiscard]] const T& getCurr() const noexcept
+    {
+        return curr;
+    }
+};
+
+/// @brief Position, rotation, scale and origin of an `sf::Transformable` at
+/// the previous and current simulation tick.
+class InterpolatedTransform
+{
+private:
+    struct State
+    {
+        Vec2f position, scale{1.f, 1.f}, origin;
+        float rotation{0.f};
+    };
+
+    State prev, curr;
+
+    [[nodiscard]] static State getState(const sf::Transformable& mX) noexcept
+    {
+        return {mX.getPosition(), mX.getScale(), mX.getOrigin(),
+            mX.getRotation()};
+    }
+
+public:
+    InterpolatedTransform() = default;
+    InterpolatedTransform(const sf::Transformable& mX)
+    {
+        snap(mX);
+    }
+
+    void push(const sf::Transformable& mX) noexcept
+    {
+        prev = curr;
+        curr = getState(mX);
+    }
+
+    void snap(const sf::Transformable& mX) noexcept
+    {
+        prev = curr = getState(mX);
+    }
+
+    /// @brief Returns the interpolated transform, computed the same way as
+    /// `sf::Transformable::getTransform`.
+    [[nodiscard]] sf::Transform getTransform(float mAlpha) const noexcept
+    {
+        const auto position(
+            getInterpolated(prev.position, curr.position, mAlpha));
+        const auto scale(getInterpolated(prev.scale, curr.scale, mAlpha));
+        const auto origin(getInterpolated(prev.origin, curr.origin, mAlpha));
+        const auto rotation(
+            getInterpolatedDeg(prev.rotation, curr.rotation, mAlpha));
+
+        const auto angle(-rotation * 3.141592654f / 180.f);
+        const auto cosine(std::cos(angle));
+        const auto sine(std::sin(angle));
+        const auto sxc(scale.x * cosine);
+        const auto syc(scale.y * cosine);
+        const auto sxs(scale.x * sine);
+        const auto sys(scale.y * sine);
+        const auto tx(-origin.x * sxc - origin.y * sys + position.x);
+        const auto ty(origin.x * sxs - origin.y * syc + position.y);
+
+        return {sxc, sys, tx, -sxs, syc, ty, 0.f, 0.f, 1.f};
+    }
+};
+
+} // namespace ssvs
@@ -0,0 +1,74 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+int main()
+{
+    using namespace ssvs;
+
+    const auto dir(std::filesystem::temp_directory_path());
+    const std::string pathA{(dir / "ssvs_test_archive_a.bin").string()};
+    const std::string pathB{(dir / "ssvs_test_archive_b.txt").string()};
+    const std::string pathEmpty{(dir / "ssvs_test_archive_e.txt").string()};
+    const std::string pathArchive{(dir / "ssvs_test_archive.ssva").string()};
+
+    const std::string dataA("\x01\x02\x00\x03\xff", 5);
+    const std::string dataB{"void main() {}"};
+
+    std::ofstream{pathA, std::ios::binary} << dataA;
+    std::ofstream{pathB, std::ios::binary} << dataB;
+    std::ofstream{pathEmpty, std::ios::binary};
+
+    {
+        AssetArchiveWriter writer;
+        TEST_ASSERT(writer.add("Sprites/a.bin", pathA));
+        TEST_ASSERT(writer.add("Shaders/b.frag", pathB));
+        TEST_ASSERT(writer.add("empty", pathEmpty));
+        TEST_ASSERT(!writer.add("missing", pathA + ".missing"));
+        TEST_ASSERT(writer.write(pathArchive));
+    }
+
+    {
+        AssetArchive archive{pathArchive};
+        TEST_ASSERT(archive.isOpen());
+        TEST_ASSERT_OP(archive.getEntries().size(), ==, 3u);
+        TEST_ASSERT(archive.has("Sprites/a.bin"));
+        TEST_ASSERT(!archive.has("missing"));
+        TEST_ASSERT(archive.find("missing") == nullptr);
+
+        const auto* a(archive.find("Sprites/a.bin"));
+        TEST_ASSERT(a != nullptr);
+        TEST_ASSERT_OP(a->size, ==, dataA.size());
+        TEST_ASSERT(std::memcmp(a->data, dataA.data(), dataA.size()) == 0);
+        TEST_ASSERT_OP(reinterpret_cast<std::uintptr_t>(a->data) % 16, ==, 0u);
+
+        TEST_ASSERT_OP(archive.find("empty")->size, ==, 0u);
+
+        auto stream(archive.getStream("Shaders/b.frag"));
+        TEST_ASSERT_OP(stream.getSize(), ==, sf::Int64(dataB.size()));
+
+        std::string read(dataB.size(), '\0');
+        TEST_ASSERT_OP(stream.read(read.data(), sf::Int64(read.size())), ==,
+            sf::Int64(dataB.size()));
+        TEST_ASSERT_OP(read, ==, dataB);
+    }
+
+    // Malformed archives are rejected.
+    {
+        std::ofstream{pathA, std::ios::binary} << "SSVA\x01";
+        TEST_ASSERT(!AssetArchive{pathA}.isOpen());
+        TEST_ASSERT(!AssetArchive{pathA + ".missing"}.isOpen());
+    }
+
+    for(const auto& p : {pathA, pathB, pathEmpty, pathArchive})
+        std::filesystem::remove(p);
+}
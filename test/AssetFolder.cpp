@@ -0,0 +1,110 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+namespace
+{
+    // Records what `AssetFolder` registers, without loading textures, which
+    // need a GL context.
+    struct RecordingManager
+    {
+        std::thread::id owner{std::this_thread::get_id()};
+        std::set<std::string> images, textures, soundBuffers, musics;
+        std::set<std::string> decodedImages, fallbackImages;
+        bool wrongThread{false};
+
+        template <typename T>
+        void add(const std::string& mId)
+        {
+            wrongThread = wrongThread || std::this_thread::get_id() != owner;
+
+            if constexpr(std::is_same_v<T, sf::Image>) images.insert(mId);
+            if constexpr(std::is_same_v<T, sf::Texture>) textures.insert(mId);
+            if constexpr(std::is_same_v<T, sf::SoundBuffer>)
+                soundBuffers.insert(mId);
+            if constexpr(std::is_same_v<T, sf::Music>) musics.insert(mId);
+        }
+
+        template <typename T, typename... TArgs>
+        void load(const std::string& mId, const TArgs&...)
+        {
+            // Images are only loaded from their path if they failed to
+            // decode on a worker.
+            if constexpr(std::is_same_v<T, sf::Image>)
+                fallbackImages.insert(mId);
+
+            add<T>(mId);
+        }
+
+        template <typename T>
+        void adopt(const std::string& mId, std::unique_ptr<T> mPtr)
+        {
+            if(mPtr != nullptr) decodedImages.insert(mId);
+            add<T>(mId);
+        }
+    };
+} // namespace
+
+int main()
+{
+    using namespace ssvs;
+
+    const auto root(
+        std::filesystem::temp_directory_path() / "ssvs_test_folder");
+    std::filesystem::remove_all(root);
+    std::filesystem::create_directories(root / "Sub");
+
+    const std::string imageIds[]{"a.png", "Sub/b.png", "c.png"};
+    for(unsigned int i{0}; i < 3; ++i)
+    {
+        sf::Image image;
+        image.create(4 + i, 4, sf::Color::White);
+        TEST_ASSERT(image.saveToFile((root / imageIds[i]).string()));
+    }
+
+    std::ofstream{root / "broken.png"} << "not an image";
+    std::ofstream{root / "Sub/beep.wav"} << "not a sound";
+    std::ofstream{root / "notes.txt"} << "ignored";
+
+    JobSystem jobs{2};
+    RecordingManager mgr;
+
+    AssetFolder folder{root.string() + "/"};
+    folder.loadToManager(mgr, jobs);
+
+    TEST_ASSERT(!mgr.wrongThread);
+
+    // Every image is registered as both an image and a texture, including
+    // the one that fails to decode.
+    for(const auto& id : imageIds)
+    {
+        TEST_ASSERT(mgr.images.contains(id));
+        TEST_ASSERT(mgr.textures.contains(id));
+        TEST_ASSERT(mgr.decodedImages.contains(id));
+    }
+
+    TEST_ASSERT(mgr.images.contains("broken.png"));
+    TEST_ASSERT(mgr.textures.contains("broken.png"));
+    TEST_ASSERT(mgr.fallbackImages.contains("broken.png"));
+    TEST_ASSERT(!mgr.decodedImages.contains("broken.png"));
+    TEST_ASSERT_OP(mgr.images.size(), ==, 4u);
+    TEST_ASSERT_OP(mgr.textures.size(), ==, 4u);
+
+    // Sounds are registered whether they decode or not.
+    TEST_ASSERT(mgr.soundBuffers.contains("Sub/beep.wav"));
+    TEST_ASSERT(mgr.musics.contains("Sub/beep.wav"));
+    TEST_ASSERT_OP(mgr.soundBuffers.size(), ==, 1u);
+
+    std::filesystem::remove_all(root);
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <filesystem>
+#include <string>
+
+int main()
+{
+    using namespace ssvs;
+
+    const auto dir(std::filesystem::temp_directory_path());
+    std::string paths[4];
+
+    for(unsigned int i{0}; i < 4; ++i)
+    {
+        paths[i] = (dir / ("ssvs_test_group" + std::to_string(i) + ".png"))
+                       .string();
+
+        sf::Image image;
+        image.create(8, 8, sf::Color::White);
+        TEST_ASSERT(image.saveToFile(paths[i]));
+    }
+
+    AssetManager<> mgr;
+    mgr.load<sf::Image>("global", ssvufs::Path{paths[3]});
+
+    mgr.createGroup("menu")
+        .add<sf::Image>("menu", ssvufs::Path{paths[0]})
+        .add<sf::Image>("shared", ssvufs::Path{paths[2]});
+
+    mgr.createGroup("level")
+        .add<sf::Image>("level", ssvufs::Path{paths[1]})
+        .add<sf::Image>("shared", ssvufs::Path{paths[2]})
+        .add<sf::Image>("global", ssvufs::Path{paths[3]});
+
+    const auto baseline(mgr.getMemoryReport().getTotalBytes());
+
+    mgr.loadGroup("menu");
+    mgr.loadGroup("menu");
+    TEST_ASSERT(mgr.getGroup("menu").isLoaded());
+    TEST_ASSERT(mgr.has<sf::Image>("menu") && mgr.has<sf::Image>("shared"));
+    TEST_ASSERT_OP(mgr.getRefCount<sf::Image>("shared"), ==, 1u);
+
+    mgr.loadGroup("level");
+    TEST_ASSERT_OP(mgr.getRefCount<sf::Image>("shared"), ==, 2u);
+    TEST_ASSERT_OP(mgr.getRefCount<sf::Image>("global"), ==, 1u);
+
+    const auto hLevel(mgr.getHandle<sf::Image>("level"));
+    TEST_ASSERT_OP(mgr.get(hLevel).getSize().x, ==, 8u);
+
+    // Shared resources stay while another loaded group uses them.
+    mgr.unloadGroup("menu");
+    TEST_ASSERT(!mgr.has<sf::Image>("menu"));
+    TEST_ASSERT(mgr.has<sf::Image>("shared"));
+
+    // Resources loaded outside of groups are never unloaded by them.
+    mgr.unloadGroup("level");
+    TEST_ASSERT(!mgr.has<sf::Image>("level"));
+    TEST_ASSERT(!mgr.has<sf::Image>("shared"));
+    TEST_ASSERT(mgr.has<sf::Image>("global"));
+    TEST_ASSERT_OP(mgr.getMemoryReport().getTotalBytes(), ==, baseline);
+
+    // Handles to unloaded resources resolve like missing ids, then to the
+    // reloaded resource.
+    TEST_ASSERT(&mgr.get(hLevel) == &getDefaultAsset<sf::Image>());
+
+    // Scopes owned by a state keep their group loaded for its lifetime.
+    {
+        GameState state;
+        state.keepAlive(AssetGroupScope{mgr, "level"});
+
+        TEST_ASSERT(mgr.getGroup("level").isLoaded());
+        TEST_ASSERT(&mgr.get(hLevel) == &mgr.get<sf::Image>("level"));
+        TEST_ASSERT(&mgr.get(hLevel) != &getDefaultAsset<sf::Image>());
+    }
+
+    TEST_ASSERT(!mgr.getGroup("level").isLoaded());
+    TEST_ASSERT(!mgr.has<sf::Image>("level"));
+    TEST_ASSERT_OP(mgr.getMemoryReport().getTotalBytes(), ==, baseline);
+
+    // Resources added to a loaded group are loaded right away, and
+    // unloaded with it.
+    mgr.createGroup("late").add<sf::Image>("menu", ssvufs::Path{paths[0]});
+    mgr.loadGroup("late");
+    mgr.getGroup("late").add<sf::Image>("level", ssvufs::Path{paths[1]});
+    TEST_ASSERT(mgr.has<sf::Image>("level"));
+    TEST_ASSERT_OP(mgr.getRefCount<sf::Image>("level"), ==, 1u);
+
+    mgr.unloadGroup("late");
+    TEST_ASSERT(!mgr.has<sf::Image>("menu"));
+    TEST_ASSERT(!mgr.has<sf::Image>("level"));
+    TEST_ASSERT_OP(mgr.getMemoryReport().getTotalBytes(), ==, baseline);
+
+    // Releasing ids that were never retained does nothing.
+    mgr.release<sf::Image>("unknown");
+    TEST_ASSERT(!mgr.has<sf::Image>("unknown"));
+
+    for(const auto& p : paths) std::filesystem::remove(p);
+}
@@ -0,0 +1,165 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <string>
+
+static_assert(ssvs::Impl::getFnv1a("") == 0xcbf29ce484222325ull);
+static_assert(ssvs::Impl::getFnv1a("abc") == 0xe71fa2190541574bull);
+static_assert(ssvs::AssetId{"a"} == ssvs::AssetId{std::string_view{"a"}});
+
+int main()
+{
+    using namespace ssvs;
+
+    // Handles resolve to the same resources as string ids.
+    {
+        AssetManager<> mgr;
+
+        auto& small(mgr.load<Tileset>("small", Tileset{Vec2u{8, 8}}));
+        auto& big(mgr.load<Tileset>("big", Tileset{Vec2u{32, 32}}));
+
+        const auto hSmall(mgr.getHandle<Tileset>("small"));
+        const auto hBig(mgr.getHandle<Tileset>(AssetId{"big"}));
+
+        TEST_ASSERT(hSmall.isValid() && hBig.isValid());
+        TEST_ASSERT(!(hSmall == hBig));
+        TEST_ASSERT(&mgr.get(hSmall) == &small);
+        TEST_ASSERT(&mgr.get(hBig) == &big);
+        TEST_ASSERT(&mgr.get(hBig) == &mgr.get<Tileset>("big"));
+
+        constexpr AssetId missing{"missing"};
+        TEST_ASSERT(!mgr.getHandle<Tileset>(missing).isValid());
+        TEST_ASSERT(!AssetHandle<Tileset>{}.isValid());
+    }
+
+    // Invalid handles resolve to the null asset.
+    {
+        AssetManager<> mgr;
+        (void)mgr.adopt<sf::Image>("image", std::make_unique<sf::Image>());
+
+        constexpr AssetId missing{"missing"};
+        TEST_ASSERT(&mgr.get(AssetHandle<sf::Image>{}) ==
+                    &getDefaultAsset<sf::Image>());
+        TEST_ASSERT(&mgr.get(mgr.getHandle<sf::Image>(missing)) ==
+                    &getDefaultAsset<sf::Image>());
+    }
+
+    // Missing ids resolve to the null asset, and handles to asynchronously
+    // loaded resources follow the placeholder's replacement.
+    {
+        const auto path(
+            (std::filesystem::temp_directory_path() / "ssvs_test_handle.png")
+                .string());
+
+        sf::Image image;
+        image.create(6, 4, sf::Color::White);
+        TEST_ASSERT(image.saveToFile(path));
+
+        AssetManager<> mgr;
+
+        const auto hMissing(mgr.getHandle<sf::Image>("missing"));
+        TEST_ASSERT(hMissing.isValid());
+        TEST_ASSERT(&mgr.get(hMissing) == &getDefaultAsset<sf::Image>());
+
+        auto a(mgr.loadAsync<sf::Image>("a", path));
+        const auto hA(mgr.getHandle<sf::Image>(AssetId{"a"}));
+        TEST_ASSERT(&mgr.get(hA) == &getDefaultAsset<sf::Image>());
+
+        mgr.finishAsync();
+        TEST_ASSERT(a.isReady());
+        TEST_ASSERT(&mgr.get(hA) == &a.get());
+        TEST_ASSERT_OP(mgr.get(hA).getSize().x, ==, 6u);
+
+        // A pending load cannot be replaced, a completed one neither.
+        auto b(mgr.loadAsync<sf::Image>("b", path));
+        TEST_ASSERT(!mgr.canLoad<sf::Image>("b"));
+        mgr.finishAsync();
+        TEST_ASSERT(b.isReady());
+        TEST_ASSERT(!mgr.canLoad<sf::Image>("b"));
+
+        std::filesystem::remove(path);
+    }
+
+    // Handles resolved before loading are filled by a later load, or by
+    // the group acquiring the id.
+    {
+        const auto path(
+            (std::filesystem::temp_directory_path() / "ssvs_test_handle.png")
+                .string());
+
+        sf::Image image;
+        image.create(6, 4, sf::Color::White);
+        TEST_ASSERT(image.saveToFile(path));
+
+        AssetManager<> mgr;
+
+        const auto hEarly(mgr.getHandle<sf::Image>("early"));
+        TEST_ASSERT(&mgr.get(hEarly) == &getDefaultAsset<sf::Image>());
+        TEST_ASSERT(mgr.has<sf::Image>("early"));
+        TEST_ASSERT(mgr.canLoad<sf::Image>("early"));
+
+        auto& early(mgr.load<sf::Image>("early", ssvufs::Path{path}));
+        TEST_ASSERT(&early != &getDefaultAsset<sf::Image>());
+        TEST_ASSERT(&mgr.get(hEarly) == &early);
+        TEST_ASSERT(&mgr.get<sf::Image>("early") == &early);
+
+        const auto hGroup(mgr.getHandle<sf::Image>("grouped"));
+        mgr.createGroup("level").add<sf::Image>(
+            "grouped", ssvufs::Path{path});
+
+        mgr.loadGroup("level");
+        TEST_ASSERT(&mgr.get(hGroup) != &getDefaultAsset<sf::Image>());
+        TEST_ASSERT_OP(mgr.get(hGroup).getSize().x, ==, 6u);
+
+        // The group loaded it, so it also unloads it.
+        mgr.unloadGroup("level");
+        TEST_ASSERT(&mgr.get(hGroup) == &getDefaultAsset<sf::Image>());
+
+        std::filesystem::remove(path);
+    }
+
+    // Unloading frees one resource and keeps the others mapped, including
+    // after `adopt` replaced some.
+    {
+        Impl::ResourceHolder<sf::Image, RHPolicyDefault> rh;
+
+        const auto make([](unsigned int mWidth) {
+            auto result(std::make_unique<sf::Image>());
+            result->create(mWidth, 1, sf::Color::White);
+            return result;
+        });
+
+        rh.adopt("x", make(1));
+        rh.adopt("y", make(2));
+        rh.adopt("x", make(3));
+        rh.adopt("z", make(4));
+
+        const auto hX(rh.getHandle("x"));
+        TEST_ASSERT_OP(rh[hX].getSize().x, ==, 3u);
+
+        TEST_ASSERT(rh.unload("y"));
+        TEST_ASSERT(!rh.has("y"));
+        TEST_ASSERT_OP(rh["x"].getSize().x, ==, 3u);
+        TEST_ASSERT_OP(rh["z"].getSize().x, ==, 4u);
+
+        TEST_ASSERT(rh.unload("x"));
+        TEST_ASSERT(&rh[hX] == &getDefaultAsset<sf::Image>());
+        TEST_ASSERT_OP(rh["z"].getSize().x, ==, 4u);
+
+        TEST_ASSERT(rh.unload("z"));
+        TEST_ASSERT(!rh.unload("z"));
+        TEST_ASSERT_OP(rh.getMemory().bytes, ==, 0u);
+
+        // Ids only mapped to the null asset are unmapped too.
+        rh.adopt("none", nullptr);
+        TEST_ASSERT(rh.unload("none"));
+        TEST_ASSERT(!rh.has("none"));
+        TEST_ASSERT(!rh.unload("none"));
+    }
+}
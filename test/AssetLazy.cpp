@@ -0,0 +1,87 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <filesystem>
+#include <string>
+
+int main()
+{
+    using namespace ssvs;
+
+    const auto dir(std::filesystem::temp_directory_path());
+    const std::string pathA{(dir / "ssvs_test_lazy_a.png").string()};
+    const std::string pathB{(dir / "ssvs_test_lazy_b.png").string()};
+
+    for(const auto& p : {pathA, pathB})
+    {
+        sf::Image image;
+        image.create(16, 16, sf::Color::White);
+        TEST_ASSERT(image.saveToFile(p));
+    }
+
+    constexpr std::size_t imageBytes{16 * 16 * 4};
+
+    {
+        AssetManager<> mgr;
+        mgr.registerLazy<sf::Image>("a", pathA);
+        mgr.registerLazy<sf::Image>("b", pathB);
+        mgr.registerLazy<sf::Image>("gone", pathA + ".missing");
+
+        // Registered, but nothing is loaded yet.
+        TEST_ASSERT(mgr.has<sf::Image>("a"));
+        TEST_ASSERT(!mgr.isLoaded<sf::Image>("a"));
+        TEST_ASSERT_OP(mgr.getLazyBytes<sf::Image>(), ==, 0u);
+
+        const auto& cMgr(mgr);
+        TEST_ASSERT(
+            &cMgr.get<sf::Image>("a") == &getDefaultAsset<sf::Image>());
+
+        // Loaded on first access, through an id or a handle.
+        TEST_ASSERT_OP(mgr.get<sf::Image>("a").getSize().x, ==, 16u);
+        TEST_ASSERT(mgr.isLoaded<sf::Image>("a"));
+        TEST_ASSERT(&cMgr.get<sf::Image>("a") == &mgr.get<sf::Image>("a"));
+
+        const auto hB(mgr.getHandle<sf::Image>("b"));
+        TEST_ASSERT(!mgr.isLoaded<sf::Image>("b"));
+        TEST_ASSERT_OP(mgr.get(hB).getSize().y, ==, 16u);
+        TEST_ASSERT_OP(mgr.getLazyBytes<sf::Image>(), ==, 2 * imageBytes);
+
+        // Within budget: nothing is evicted.
+        TEST_ASSERT_OP(mgr.trimLazy(), ==, 0u);
+
+        // "a" was used last, so "b" is evicted first.
+        (void)mgr.get<sf::Image>("a");
+        mgr.setLazyBudget<sf::Image>(imageBytes + imageBytes / 2);
+        TEST_ASSERT_OP(mgr.trimLazy(), ==, 1u);
+        TEST_ASSERT(mgr.isLoaded<sf::Image>("a"));
+        TEST_ASSERT(!mgr.isLoaded<sf::Image>("b"));
+        TEST_ASSERT_OP(mgr.getLazyBytes<sf::Image>(), ==, imageBytes);
+
+        // Evicted resources are loaded again through their handles.
+        TEST_ASSERT_OP(mgr.get(hB).getSize().x, ==, 16u);
+        TEST_ASSERT(mgr.isLoaded<sf::Image>("b"));
+
+        // Failed loads resolve to the null asset and are not retried.
+        TEST_ASSERT(
+            &mgr.get<sf::Image>("gone") == &getDefaultAsset<sf::Image>());
+        TEST_ASSERT(!mgr.isLoaded<sf::Image>("gone"));
+        TEST_ASSERT_OP(mgr.getLazyBytes<sf::Image>(), ==, 2 * imageBytes);
+
+        // Using a loaded resource through its handle also counts as a use.
+        mgr.setLazyBudget<sf::Image>(4 * imageBytes);
+        (void)mgr.get<sf::Image>("a");
+        TEST_ASSERT_OP(mgr.trimLazy(), ==, 0u);
+        (void)mgr.get(hB);
+        mgr.setLazyBudget<sf::Image>(imageBytes + imageBytes / 2);
+        TEST_ASSERT_OP(mgr.trimLazy(), ==, 1u);
+        TEST_ASSERT(!mgr.isLoaded<sf::Image>("a"));
+        TEST_ASSERT(mgr.isLoaded<sf::Image>("b"));
+    }
+
+    std::filesystem::remove(pathA);
+    std::filesystem::remove(pathB);
+}
@@ -0,0 +1,90 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <filesystem>
+#include <string>
+
+int main()
+{
+    using namespace ssvs;
+
+    const auto dir(std::filesystem::temp_directory_path());
+    std::string paths[3];
+
+    for(unsigned int i{0}; i < 3; ++i)
+    {
+        paths[i] = (dir / ("ssvs_test_asset" + std::to_string(i) + ".png"))
+                       .string();
+
+        sf::Image image;
+        image.create(4 + i, 4, sf::Color::White);
+        TEST_ASSERT(image.saveToFile(paths[i]));
+    }
+
+    const std::string missing{(dir / "ssvs_test_missing.png").string()};
+
+    // Decoded on the calling thread, registered by `updateAsync`.
+    {
+        AssetManager<> mgr;
+
+        auto a(mgr.loadAsync<sf::Image>("a", paths[0]));
+        auto m(mgr.loadAsync<sf::Image>("m", missing));
+
+        TEST_ASSERT(!a.isReady());
+        TEST_ASSERT(&a.get() == &getDefaultAsset<sf::Image>());
+        TEST_ASSERT(&mgr.get<sf::Image>("a") == &a.get());
+        TEST_ASSERT(mgr.isLoadingAsync());
+        TEST_ASSERT_OP(mgr.getLoadProgress().requested, ==, 2u);
+
+        TEST_ASSERT_OP(mgr.updateAsync(1), ==, 1u);
+        TEST_ASSERT(a.isReady() && !a.isFailed());
+        TEST_ASSERT_OP(a.get().getSize().x, ==, 4u);
+        TEST_ASSERT(&mgr.get<sf::Image>("a") == &a.get());
+        TEST_ASSERT(!mgr.getLoadProgress().isDone());
+
+        TEST_ASSERT_OP(mgr.updateAsync(), ==, 1u);
+        TEST_ASSERT(m.isReady() && m.isFailed());
+        TEST_ASSERT(&m.get() == &getDefaultAsset<sf::Image>());
+        TEST_ASSERT(!mgr.isLoadingAsync());
+
+        const auto p(mgr.getLoadProgress());
+        TEST_ASSERT(p.isDone());
+        TEST_ASSERT_OP(p.loaded, ==, 1u);
+        TEST_ASSERT_OP(p.failed, ==, 1u);
+        TEST_ASSERT_OP(p.getRatio(), ==, 1.f);
+    }
+
+    // Decoded on a job system.
+    {
+        JobSystem jobs{2};
+        AssetManager<> mgr;
+        mgr.setJobSystem(jobs);
+
+        AsyncAsset<sf::Image> handles[3]{
+            mgr.loadAsync<sf::Image>("0", paths[0]),
+            mgr.loadAsync<sf::Image>("1", paths[1]),
+            mgr.loadAsync<sf::Image>("2", paths[2])};
+
+        mgr.finishAsync();
+
+        for(unsigned int i{0}; i < 3; ++i)
+        {
+            TEST_ASSERT(handles[i].isReady());
+            TEST_ASSERT_OP(handles[i].get().getSize().x, ==, 4 + i);
+        }
+
+        const auto p(mgr.getLoadProgress());
+        TEST_ASSERT_OP(p.loaded, ==, 3u);
+        TEST_ASSERT_OP(p.bytesCompleted, ==, p.bytesRequested);
+
+        // A new request after completion starts a new batch.
+        (void)mgr.loadAsync<sf::Image>("3", paths[0]);
+        TEST_ASSERT_OP(mgr.getLoadProgress().requested, ==, 1u);
+    }
+
+    for(const auto& p : paths) std::filesystem::remove(p);
+}
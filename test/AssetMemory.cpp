@@ -0,0 +1,112 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+namespace
+{
+    auto makeImage(unsigned int mWidth, unsigned int mHeight)
+    {
+        auto result(std::make_unique<sf::Image>());
+        result->create(mWidth, mHeight, sf::Color::White);
+        return result;
+    }
+
+    const ssvs::AssetMemoryReport::TypeTotals& getTotals(
+        const ssvs::AssetMemoryReport& mReport, std::string_view mType)
+    {
+        for(const auto& t : mReport.getTypes())
+            if(t.type == mType) return t;
+
+        TEST_ASSERT(false);
+        return mReport.getTypes().front();
+    }
+}
+
+int main()
+{
+    using namespace ssvs;
+
+    const auto dir(std::filesystem::temp_directory_path());
+    const std::string pathLazy{(dir / "ssvs_test_memory.png").string()};
+    const std::string pathFont{(dir / "ssvs_test_memory.ttf").string()};
+
+    TEST_ASSERT(makeImage(32, 32)->saveToFile(pathLazy));
+    std::ofstream{pathFont, std::ios::binary} << std::string(300, 'f');
+
+    AssetManager<> mgr;
+    mgr.adopt<sf::Image>("Sprites/Player/idle.png", makeImage(64, 64));
+    mgr.adopt<sf::Image>("Sprites/enemy.png", makeImage(16, 16));
+    mgr.adopt<sf::Image>("Backgrounds/sky.png", makeImage(256, 128));
+    mgr.load<sf::Font>("Fonts/main.ttf", ssvufs::Path{pathFont});
+    mgr.registerLazy<sf::Image>("Lazy/a.png", pathLazy);
+
+    // Null assets and placeholders are not accounted for.
+    (void)mgr.getHandle<sf::Image>("missing");
+
+    const std::size_t idle{64 * 64 * 4}, enemy{16 * 16 * 4},
+        sky{256 * 128 * 4}, lazy{32 * 32 * 4};
+
+    {
+        const auto report(mgr.getMemoryReport());
+        TEST_ASSERT_OP(report.getTotalBytes(), ==, idle + enemy + sky + 300);
+        TEST_ASSERT_OP(report.getEntries().size(), ==, 4u);
+        TEST_ASSERT(report.getEntries().front().id == "Backgrounds/sky.png");
+
+        const auto& images(getTotals(report, "Image"));
+        TEST_ASSERT_OP(images.count, ==, 3u);
+        TEST_ASSERT_OP(images.bytes, ==, idle + enemy + sky);
+        TEST_ASSERT_OP(getTotals(report, "Font").bytes, ==, 300u);
+
+        TEST_ASSERT_OP(report.getBytesWithPrefix("Sprites/"), ==, idle + enemy);
+        TEST_ASSERT_OP(report.getLargerThan(idle).size(), ==, 1u);
+
+        const auto groups(report.getPrefixTotals());
+        TEST_ASSERT_OP(groups.size(), ==, 3u);
+        TEST_ASSERT(groups[0].first == "Backgrounds");
+        TEST_ASSERT(groups[1].first == "Sprites");
+        TEST_ASSERT_OP(groups[1].second, ==, idle + enemy);
+
+        const auto nested(report.getPrefixTotals(2));
+        TEST_ASSERT(nested[1].first == "Sprites/Player");
+
+        std::ostringstream os;
+        report.print(os);
+        TEST_ASSERT(os.str().find("Backgrounds/sky.png") != std::string::npos);
+
+        // The format of the stream is left as it was.
+        os << 0.25;
+        TEST_ASSERT(os.str().ends_with("\n0.25"));
+    }
+
+    // Lazy resources count while loaded, and the peak remembers them.
+    const auto base(mgr.getMemoryReport().getTotalBytes());
+
+    (void)mgr.get<sf::Image>("Lazy/a.png");
+    TEST_ASSERT_OP(mgr.getMemoryReport().getTotalBytes(), ==, base + lazy);
+
+    mgr.setLazyBudget<sf::Image>(0);
+    TEST_ASSERT_OP(mgr.trimLazy(), ==, 1u);
+
+    {
+        const auto report(mgr.getMemoryReport());
+        TEST_ASSERT_OP(report.getTotalBytes(), ==, base);
+        TEST_ASSERT_OP(report.getPeakBytes(), ==, base + lazy);
+        TEST_ASSERT_OP(getTotals(report, "Image").peakBytes, ==,
+            idle + enemy + sky + lazy);
+    }
+
+    mgr.resetMemoryPeaks();
+    TEST_ASSERT_OP(mgr.getMemoryReport().getPeakBytes(), ==, base);
+
+    std::filesystem::remove(pathLazy);
+    std::filesystem::remove(pathFont);
+}
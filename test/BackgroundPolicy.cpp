@@ -0,0 +1,137 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <cstddef>
+
+namespace
+{
+    sf::Event makeEvent(sf::Event::EventType mType)
+    {
+        sf::Event e;
+        e.type = mType;
+        return e;
+    }
+} // namespace
+
+int main()
+{
+    using namespace ssvs;
+
+    {
+        // Paused: unfocused frames only process events until the focus is
+        // gained back.
+        GameHeadless headless;
+        GameState state;
+        std::size_t updates{0}, focusEvents{0};
+
+        state.onUpdate += [&updates](FT) { ++updates; };
+        state.onAnyEvent += [&focusEvents](const sf::Event& mEvent) {
+            if(mEvent.type == sf::Event::GainedFocus) ++focusEvents;
+        };
+
+        BackgroundPolicy policy;
+        policy.mode = BackgroundMode::Paused;
+
+        headless.setGameState(state);
+        headless.setTimer<TimerStatic>(1.f, 1.f);
+        headless.setBackgroundPolicy(policy);
+
+        headless.run(2);
+        TEST_ASSERT_OP(updates, ==, 2u);
+
+        // The frame that loses the focus still runs.
+        headless.pushEvent(makeEvent(sf::Event::LostFocus));
+        headless.step();
+        TEST_ASSERT(!headless.hasFocus());
+        TEST_ASSERT_OP(updates, ==, 3u);
+
+        const auto stats(headless.run(5));
+        TEST_ASSERT_OP(stats.frames, ==, 0u);
+        TEST_ASSERT_OP(updates, ==, 3u);
+        TEST_ASSERT_OP(headless.getPausedFrames(), ==, 5u);
+
+        // Other events are processed while waiting for the focus.
+        headless.pushEvent(makeEvent(sf::Event::Resized));
+        headless.step();
+        TEST_ASSERT_OP(headless.getPausedFrames(), ==, 6u);
+
+        headless.pushEvent(makeEvent(sf::Event::GainedFocus));
+        headless.step();
+        TEST_ASSERT(headless.hasFocus());
+        TEST_ASSERT_OP(focusEvents, ==, 1u);
+        TEST_ASSERT_OP(updates, ==, 4u);
+        TEST_ASSERT_OP(headless.getPausedFrames(), ==, 6u);
+
+        // Closing while paused stops the engine.
+        headless.pushEvent(makeEvent(sf::Event::LostFocus));
+        headless.step();
+        headless.pushEvent(makeEvent(sf::Event::Closed));
+        headless.step();
+        TEST_ASSERT(!headless.isRunning());
+    }
+
+    {
+        // Throttled: unfocused frames run one tick at most, without drawing.
+        GameHeadless headless;
+        GameState state;
+        std::size_t draws{0};
+
+        state.onDraw += [&draws] { ++draws; };
+
+        BackgroundPolicy policy;
+        policy.mode = BackgroundMode::Throttled;
+
+        headless.setGameState(state);
+        headless.setTimer<TimerStatic>(1.f, 1.f);
+        headless.setBackgroundPolicy(policy);
+        headless.setDrawEnabled(true);
+        headless.setFrameTime(5.f);
+
+        auto stats(headless.run(2));
+        TEST_ASSERT_OP(stats.ticks, ==, 10u);
+        TEST_ASSERT_OP(draws, ==, 2u);
+
+        headless.pushEvent(makeEvent(sf::Event::LostFocus));
+        stats = headless.run(4);
+        TEST_ASSERT_OP(stats.frames, ==, 4u);
+        TEST_ASSERT_OP(stats.ticks, ==, 4u);
+        TEST_ASSERT_OP(draws, ==, 2u);
+
+        headless.pushEvent(makeEvent(sf::Event::GainedFocus));
+        stats = headless.run(1);
+        TEST_ASSERT_OP(stats.ticks, ==, 5u);
+        TEST_ASSERT_OP(draws, ==, 3u);
+        TEST_ASSERT_OP(headless.getPausedFrames(), ==, 0u);
+    }
+
+    {
+        BackgroundController controller;
+        TEST_ASSERT(controller.hasFocus());
+        TEST_ASSERT(!controller.handleEvent(makeEvent(sf::Event::GainedFocus)));
+
+        controller.handleEvent(makeEvent(sf::Event::LostFocus));
+        TEST_ASSERT(!controller.isPaused());
+        TEST_ASSERT(!controller.isThrottled());
+        TEST_ASSERT(controller.isDrawing());
+        TEST_ASSERT_OP(controller.getFrameTime(5.f), ==, 5.f);
+
+        BackgroundPolicy policy;
+        policy.mode = BackgroundMode::Throttled;
+        policy.skipDraw = false;
+        policy.maxFrameTime = 0.f;
+        controller.setPolicy(policy);
+
+        TEST_ASSERT(controller.isThrottled());
+        TEST_ASSERT(controller.isDrawing());
+        TEST_ASSERT_OP(controller.getFrameTime(5.f), ==, 5.f);
+
+        TEST_ASSERT(controller.handleEvent(makeEvent(sf::Event::GainedFocus)));
+        TEST_ASSERT(!controller.isThrottled());
+    }
+
+    return 0;
+}
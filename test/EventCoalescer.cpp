@@ -0,0 +1,150 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <vector>
+
+namespace
+{
+    sf::Event mouseMoved(int mX)
+    {
+        sf::Event e;
+        e.type = sf::Event::MouseMoved;
+        e.mouseMove.x = mX;
+        e.mouseMove.y = 0;
+        return e;
+    }
+
+    sf::Event wheel(float mDelta)
+    {
+        sf::Event e;
+        e.type = sf::Event::MouseWheelScrolled;
+        e.mouseWheelScroll.wheel = sf::Mouse::VerticalWheel;
+        e.mouseWheelScroll.delta = mDelta;
+        return e;
+    }
+
+    sf::Event touch(sf::Event::EventType mType, unsigned int mFinger, int mX)
+    {
+        sf::Event e;
+        e.type = mType;
+        e.touch.finger = mFinger;
+        e.touch.x = mX;
+        e.touch.y = 0;
+        return e;
+    }
+
+    sf::Event touchMoved(unsigned int mFinger, int mX)
+    {
+        return touch(sf::Event::TouchMoved, mFinger, mX);
+    }
+
+    sf::Event buttonPressed()
+    {
+        sf::Event e;
+        e.type = sf::Event::MouseButtonPressed;
+        e.mouseButton.button = sf::Mouse::Left;
+        return e;
+    }
+}
+
+int main()
+{
+    using namespace ssvs;
+
+    EventCoalescer coalescer;
+    std::vector<sf::Event> out;
+    const auto collect(
+        [&out](const sf::Event& mEvent) { out.push_back(mEvent); });
+
+    {
+        sf::Event key;
+        key.type = sf::Event::KeyPressed;
+
+        coalescer.push(mouseMoved(1));
+        coalescer.push(mouseMoved(2));
+        coalescer.push(key);
+        coalescer.push(mouseMoved(3));
+        coalescer.push(mouseMoved(4));
+        coalescer.flush(collect);
+
+        // Only the runs before and after the key press are merged.
+        TEST_ASSERT_OP(out.size(), ==, 3u);
+        TEST_ASSERT(out[0].type == sf::Event::MouseMoved);
+        TEST_ASSERT_OP(out[0].mouseMove.x, ==, 2);
+        TEST_ASSERT(out[1].type == sf::Event::KeyPressed);
+        TEST_ASSERT(out[2].type == sf::Event::MouseMoved);
+        TEST_ASSERT_OP(out[2].mouseMove.x, ==, 4);
+        TEST_ASSERT_OP(coalescer.getCoalescedCount(), ==, 2u);
+        TEST_ASSERT(coalescer.isEmpty());
+    }
+
+    {
+        out.clear();
+
+        // The press must see the cursor position right before it.
+        coalescer.push(mouseMoved(1));
+        coalescer.push(buttonPressed());
+        coalescer.push(mouseMoved(3));
+        coalescer.flush(collect);
+
+        TEST_ASSERT_OP(out.size(), ==, 3u);
+        TEST_ASSERT(out[0].type == sf::Event::MouseMoved);
+        TEST_ASSERT_OP(out[0].mouseMove.x, ==, 1);
+        TEST_ASSERT(out[1].type == sf::Event::MouseButtonPressed);
+        TEST_ASSERT_OP(out[2].mouseMove.x, ==, 3);
+    }
+
+    {
+        out.clear();
+
+        // Wheel deltas are not summed across a click.
+        coalescer.push(wheel(1.f));
+        coalescer.push(buttonPressed());
+        coalescer.push(wheel(2.f));
+        coalescer.flush(collect);
+
+        TEST_ASSERT_OP(out.size(), ==, 3u);
+        TEST_ASSERT_OP(out[0].mouseWheelScroll.delta, ==, 1.f);
+        TEST_ASSERT_OP(out[2].mouseWheelScroll.delta, ==, 2.f);
+    }
+
+    {
+        out.clear();
+
+        // Touch movements are not merged across the end of a touch.
+        coalescer.push(touchMoved(0, 1));
+        coalescer.push(touch(sf::Event::TouchEnded, 0, 1));
+        coalescer.push(touch(sf::Event::TouchBegan, 0, 7));
+        coalescer.push(touchMoved(0, 8));
+        coalescer.flush(collect);
+
+        TEST_ASSERT_OP(out.size(), ==, 4u);
+        TEST_ASSERT(out[0].type == sf::Event::TouchMoved);
+        TEST_ASSERT_OP(out[0].touch.x, ==, 1);
+        TEST_ASSERT(out[1].type == sf::Event::TouchEnded);
+        TEST_ASSERT(out[2].type == sf::Event::TouchBegan);
+        TEST_ASSERT_OP(out[3].touch.x, ==, 8);
+    }
+
+    {
+        out.clear();
+
+        coalescer.push(wheel(1.f));
+        coalescer.push(wheel(0.5f));
+        coalescer.push(wheel(-2.f));
+        coalescer.push(touchMoved(0, 1));
+        coalescer.push(touchMoved(1, 5));
+        coalescer.push(touchMoved(0, 2));
+        coalescer.flush(collect);
+
+        TEST_ASSERT_OP(out.size(), ==, 3u);
+        TEST_ASSERT_OP(out[0].mouseWheelScroll.delta, ==, -0.5f);
+        TEST_ASSERT_OP(out[1].touch.finger, ==, 1u);
+        TEST_ASSERT_OP(out[2].touch.finger, ==, 0u);
+        TEST_ASSERT_OP(out[2].touch.x, ==, 2);
+    }
+}
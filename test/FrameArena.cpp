@@ -0,0 +1,92 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+namespace
+{
+    std::size_t allocationCount{0};
+}
+
+void* operator new(std::size_t mSize)
+{
+    ++allocationCount;
+    if(void* p = std::malloc(mSize == 0 ? 1 : mSize)) return p;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* mPtr) noexcept
+{
+    std::free(mPtr);
+}
+
+void operator delete(void* mPtr, std::size_t) noexcept
+{
+    std::free(mPtr);
+}
+
+int main()
+{
+    using namespace ssvs;
+
+    {
+        FrameArena arena{128};
+
+        auto* a(arena.allocate(24, 8));
+        auto* b(arena.allocate(200, 16));
+        TEST_ASSERT(a != b);
+        TEST_ASSERT_OP(reinterpret_cast<std::uintptr_t>(b) % 16, ==, 0u);
+        TEST_ASSERT_OP(arena.getUsed(), ==, 224u);
+        TEST_ASSERT_OP(arena.getUpstreamAllocationCount(), ==, 2u);
+
+        // The two blocks are merged, so the same frame fits in one.
+        arena.reset();
+        TEST_ASSERT_OP(arena.getUsed(), ==, 0u);
+        TEST_ASSERT_OP(arena.getUpstreamAllocationCount(), ==, 3u);
+
+        a = arena.allocate(24, 8);
+        b = arena.allocate(200, 16);
+        TEST_ASSERT(a != b);
+        arena.reset();
+        TEST_ASSERT_OP(arena.getUpstreamAllocationCount(), ==, 3u);
+        TEST_ASSERT_OP(arena.getPeak(), ==, 224u);
+    }
+
+    {
+        GameHeadless headless;
+        GameState state;
+        std::size_t sum{0};
+
+        state.onUpdate += [&state, &sum](FT) {
+            std::pmr::vector<int> v{&state.getFrameResource()};
+            for(auto i(0); i < 1000; ++i) v.emplace_back(i);
+            sum += v.size();
+        };
+
+        headless.setGameState(state);
+        headless.setTimer<TimerStatic>(1.f, 1.f);
+        headless.setFrameTime(3.f);
+        headless.run(10);
+
+        const auto warm(headless.getFrameArena().getUpstreamAllocationCount());
+
+        // Once warmed up, frames neither grow the arena nor touch the heap.
+        const auto before(allocationCount);
+        headless.run(100);
+        TEST_ASSERT_OP(allocationCount, ==, before);
+
+        TEST_ASSERT_OP(sum, ==, 110u * 3 * 1000);
+        TEST_ASSERT_OP(
+            headless.getFrameArena().getUpstreamAllocationCount(), ==, warm);
+        TEST_ASSERT_OP(headless.getFrameArena().getUsed(), ==, 0u);
+    }
+}
@@ -0,0 +1,93 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <filesystem>
+#include <string>
+
+int main()
+{
+    using namespace ssvs;
+
+    const auto dir(std::filesystem::temp_directory_path());
+    const std::string shotPath{(dir / "ssvs_test_capture_shot.png").string()};
+    const std::string prefix{(dir / "ssvs_test_capture_").string()};
+    const std::string badPath{
+        (dir / "ssvs_test_capture_missing" / "shot.png").string()};
+
+    sf::Image image;
+    image.create(4, 2, sf::Color::Red);
+
+    // A screenshot and a captured frame requested for the same frame need
+    // two slots. With room for one, the screenshot is served and the frame
+    // is dropped.
+    {
+        FrameCapture fc;
+        fc.setMaxQueued(1);
+        fc.requestScreenshot(shotPath);
+        fc.startCapture(prefix);
+        TEST_ASSERT(fc.isPending());
+
+        fc.capture(image);
+        fc.stopCapture();
+        fc.flush();
+
+        const auto stats(fc.getStats());
+        TEST_ASSERT_OP(stats.captured, ==, 1u);
+        TEST_ASSERT_OP(stats.written, ==, 1u);
+        TEST_ASSERT_OP(stats.failed, ==, 0u);
+        TEST_ASSERT_OP(stats.dropped, ==, 1u);
+        TEST_ASSERT(!fc.isPending());
+        TEST_ASSERT(std::filesystem::exists(shotPath));
+        TEST_ASSERT(!std::filesystem::exists(prefix + "000000.png"));
+    }
+
+    // With enough room, both are written, and frame numbers keep counting.
+    {
+        FrameCapture fc;
+        fc.setMaxQueued(2);
+        fc.requestScreenshot(shotPath);
+        fc.startCapture(prefix);
+
+        fc.capture(image);
+        fc.flush();
+        fc.capture(image);
+        fc.stopCapture();
+        fc.flush();
+
+        const auto stats(fc.getStats());
+        TEST_ASSERT_OP(stats.captured, ==, 2u);
+        TEST_ASSERT_OP(stats.written, ==, 3u);
+        TEST_ASSERT_OP(stats.dropped, ==, 0u);
+        TEST_ASSERT(std::filesystem::exists(prefix + "000000.png"));
+        TEST_ASSERT(std::filesystem::exists(prefix + "000001.png"));
+    }
+
+    // Images that cannot be written are counted as failed, not written.
+    {
+        FrameCapture fc;
+        fc.requestScreenshot(badPath);
+        fc.capture(image);
+        fc.flush();
+
+        const auto stats(fc.getStats());
+        TEST_ASSERT_OP(stats.written, ==, 0u);
+        TEST_ASSERT_OP(stats.failed, ==, 1u);
+    }
+
+    // Without a pending request, nothing is captured.
+    {
+        FrameCapture fc;
+        TEST_ASSERT(!fc.isPending());
+        fc.capture(image);
+        fc.flush();
+        TEST_ASSERT_OP(fc.getStats().captured, ==, 0u);
+    }
+
+    std::filesystem::remove(shotPath);
+    std::filesystem::remove(prefix + "000000.png");
+    std::filesystem::remove(prefix + "000001.png");
+}
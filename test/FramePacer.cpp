@@ -0,0 +1,135 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/GameSystem/FramePacer.hpp>
+
+#include <chrono>
+
+namespace
+{
+    using namespace std::chrono_literals;
+
+    // Simulated time: sleeps overshoot by `oversleep`, spinning advances
+    // time by `spinStep` per iteration.
+    struct FakeClock
+    {
+        using duration = std::chrono::microseconds;
+        using time_point =
+            std::chrono::time_point<std::chrono::steady_clock, duration>;
+
+        inline static time_point time{};
+        inline static duration oversleep{0}, spinStep{10};
+        inline static std::size_t sleeps{0}, spins{0};
+
+        [[nodiscard]] static time_point now() noexcept
+        {
+            return time;
+        }
+
+        static void sleepUntil(time_point mTimePoint)
+        {
+            ++sleeps;
+            if(time < mTimePoint) time = mTimePoint + oversleep;
+        }
+
+        static void yield() noexcept
+        {
+            ++spins;
+            time += spinStep;
+        }
+    };
+
+    [[nodiscard]] long long getUs(FakeClock::duration mX) noexcept
+    {
+        return mX.count();
+    }
+} // namespace
+
+int main()
+{
+    using namespace ssvs;
+    using Pacer = BasicFramePacer<FakeClock>;
+
+    {
+        // Deadlines advance by a fixed period: no drift over many frames.
+        Pacer pacer{100.f};
+        pacer.setSpinMargin(1ms);
+
+        const auto start(FakeClock::now());
+        for(int i{0}; i < 100; ++i) pacer.wait();
+
+        TEST_ASSERT_OP(getUs(FakeClock::now() - start), ==, 1000000);
+        TEST_ASSERT_OP(FakeClock::sleeps, ==, 100u);
+
+        const auto stats(pacer.getStats());
+        TEST_ASSERT_OP(stats.frames, ==, 100u);
+        TEST_ASSERT_OP(stats.missed, ==, 0u);
+        TEST_ASSERT_OP(stats.maxErrorMs, <, 0.011);
+    }
+
+    {
+        // A frame later than a full period resynchronizes the schedule
+        // instead of bursting.
+        Pacer pacer{100.f};
+        pacer.wait();
+
+        FakeClock::time += 35ms;
+        const auto late(FakeClock::now());
+        pacer.wait();
+        TEST_ASSERT_OP(getUs(FakeClock::now() - late), ==, 0);
+        TEST_ASSERT_OP(pacer.getStats().missed, ==, 1u);
+
+        const auto before(FakeClock::now());
+        pacer.wait();
+        TEST_ASSERT_OP(getUs(FakeClock::now() - before), >=, 10000);
+        TEST_ASSERT_OP(pacer.getStats().missed, ==, 1u);
+
+        // A slightly late frame is caught up by the next one.
+        FakeClock::time += 12ms;
+        pacer.wait();
+        const auto caughtUp(FakeClock::now());
+        pacer.wait();
+        TEST_ASSERT_OP(getUs(FakeClock::now() - caughtUp), <, 10000);
+        TEST_ASSERT_OP(pacer.getStats().missed, ==, 1u);
+
+        pacer.resetStats();
+        TEST_ASSERT_OP(pacer.getStats().frames, ==, 0u);
+    }
+
+    {
+        // The adaptive margin covers the oversleep, up to its cap.
+        Pacer pacer{100.f};
+        FakeClock::oversleep = 500us;
+
+        for(int i{0}; i < 10; ++i) pacer.wait();
+        TEST_ASSERT_OP(getUs(pacer.getSpinMargin()), ==, 700);
+
+        pacer.resetStats();
+        for(int i{0}; i < 10; ++i) pacer.wait();
+        TEST_ASSERT_OP(pacer.getStats().maxErrorMs, <, 0.011);
+
+        FakeClock::oversleep = 5ms;
+        for(int i{0}; i < 10; ++i) pacer.wait();
+        TEST_ASSERT_OP(getUs(pacer.getSpinMargin()), ==, 2000);
+
+        pacer.setAdaptiveSpin(true, 1ms);
+        pacer.wait();
+        TEST_ASSERT_OP(getUs(pacer.getSpinMargin()), ==, 1000);
+
+        FakeClock::oversleep = 0us;
+    }
+
+    {
+        // Spinning yields instead of busy-waiting.
+        Pacer pacer{100.f};
+        pacer.setSpinMargin(100us);
+
+        FakeClock::spins = 0;
+        pacer.wait();
+        TEST_ASSERT_OP(FakeClock::spins, ==, 10u);
+    }
+
+    return 0;
+}
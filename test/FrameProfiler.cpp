@@ -0,0 +1,88 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/GameSystem/FrameProfiler.hpp>
+
+#include <sstream>
+#include <string>
+
+int main()
+{
+    using namespace ssvs;
+
+    {
+        FrameProfiler profiler(10);
+
+        const auto empty(profiler.getTicksStats());
+        TEST_ASSERT_OP(empty.max, ==, 0.f);
+        TEST_ASSERT_OP(profiler.getLastTicks(), ==, 0.f);
+
+        // Only the last 10 frames, with 16 to 25 ticks, are kept.
+        for(std::size_t i{1}; i <= 25; ++i) profiler.endFrame(i);
+
+        TEST_ASSERT_OP(profiler.getSampleCount(), ==, 10u);
+        TEST_ASSERT_OP(profiler.getLastTicks(), ==, 25.f);
+
+        const auto stats(profiler.getTicksStats());
+        TEST_ASSERT_OP(stats.p50, ==, 20.f);
+        TEST_ASSERT_OP(stats.p95, ==, 25.f);
+        TEST_ASSERT_OP(stats.p99, ==, 25.f);
+        TEST_ASSERT_OP(stats.max, ==, 25.f);
+    }
+
+    {
+        FrameProfiler profiler(100);
+
+        // Few samples: the high percentiles must not under-report.
+        for(std::size_t i{4}; i >= 1; --i) profiler.endFrame(i);
+
+        const auto stats(profiler.getTicksStats());
+        TEST_ASSERT_OP(stats.p50, ==, 2.f);
+        TEST_ASSERT_OP(stats.p95, ==, 4.f);
+        TEST_ASSERT_OP(stats.p99, ==, 4.f);
+        TEST_ASSERT_OP(stats.max, ==, 4.f);
+    }
+
+    {
+        FrameProfiler profiler(100);
+
+        for(std::size_t i{1}; i <= 100; ++i) profiler.endFrame(i);
+
+        const auto stats(profiler.getTicksStats());
+        TEST_ASSERT_OP(stats.p50, ==, 50.f);
+        TEST_ASSERT_OP(stats.p95, ==, 95.f);
+        TEST_ASSERT_OP(stats.p99, ==, 99.f);
+        TEST_ASSERT_OP(stats.max, ==, 100.f);
+
+        profiler.setWindowSize(5);
+        TEST_ASSERT_OP(profiler.getSampleCount(), ==, 0u);
+
+        profiler.endFrame(7);
+        TEST_ASSERT_OP(profiler.getTicksStats().p50, ==, 7.f);
+        TEST_ASSERT_OP(profiler.getStats(FramePhase::Total).max, >=, 0.f);
+    }
+
+    // Tick counts are printed apart from the durations, and the format of
+    // the stream is left as it was.
+    {
+        FrameProfiler profiler(4);
+        profiler.endFrame(1);
+
+        std::ostringstream os;
+        os << 0.5f << ' ';
+        profiler.dump(os);
+        os << 0.5f;
+
+        const auto out(os.str());
+        const auto ticks(out.find("update ticks per frame\n"));
+        TEST_ASSERT(ticks != std::string::npos);
+        TEST_ASSERT(out.find("ms", ticks) == std::string::npos);
+        TEST_ASSERT(out.find("1.000") == std::string::npos);
+        TEST_ASSERT(out.starts_with("0.5 "));
+        TEST_ASSERT(out.ends_with("\n0.5"));
+    }
+
+    return 0;
+}
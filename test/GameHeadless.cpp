@@ -0,0 +1,81 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+int main()
+{
+    using namespace ssvs;
+
+    {
+        GameHeadless headless;
+        GameState state;
+        std::size_t updates{0};
+
+        state.onUpdate += [&updates](FT) { ++updates; };
+
+        headless.setGameState(state);
+        headless.setTimer<TimerStatic>(1.f, 1.f);
+        headless.setFrameTime(2.f);
+
+        const auto stats(headless.run(10));
+        TEST_ASSERT_OP(stats.frames, ==, 10u);
+        TEST_ASSERT_OP(stats.ticks, ==, 20u);
+        TEST_ASSERT_OP(updates, ==, 20u);
+    }
+
+    {
+        GameHeadless headless;
+        GameState state;
+        FT lastFT{0.f};
+        std::size_t presses{0};
+
+        state.onUpdate += [&lastFT](FT mFT) { lastFT = mFT; };
+        state.addInput(
+            {{KKey::A}}, [&presses](FT) { ++presses; }, Input::Type::Once);
+
+        headless.onInput += [](Input::InputState& mState, std::size_t mFrame) {
+            mState[KKey::A] = mFrame >= 3 && mFrame < 6;
+        };
+
+        headless.setGameState(state);
+        headless.setTimer<TimerDynamic>();
+        headless.setFrameTime(2.5f);
+
+        const auto stats(headless.run(10));
+        TEST_ASSERT_OP(stats.ticks, ==, 10u);
+        TEST_ASSERT_OP(lastFT, ==, 2.5f);
+        TEST_ASSERT_OP(presses, ==, 1u);
+    }
+
+    {
+        GameHeadless headless;
+        GameState state;
+
+        state.onUpdate += [&headless](FT) { headless.stop(); };
+
+        headless.setGameState(state);
+        headless.setTimer<TimerDynamic>();
+
+        TEST_ASSERT_OP(headless.run(10).frames, ==, 1u);
+    }
+
+    {
+        BasicGameHeadless<TimerStatic> headless;
+        GameState state;
+        std::size_t updates{0};
+
+        state.onUpdate += [&updates](FT) { ++updates; };
+
+        headless.setGameState(state);
+        headless.getTimer().setStep(1.f);
+        headless.getTimer().setTimeSlice(0.5f);
+        headless.setFrameTime(1.f);
+
+        const auto stats(headless.run(10));
+        TEST_ASSERT_OP(stats.ticks, ==, 20u);
+        TEST_ASSERT_OP(updates, ==, 20u);
+    }
+}
@@ -0,0 +1,93 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <cmath>
+
+int main()
+{
+    using namespace ssvs;
+
+    const auto near([](float mA, float mB) {
+        return std::abs(mA - mB) < 0.0001f;
+    });
+
+    {
+        TEST_ASSERT(near(getInterpolated(2.f, 6.f, 0.25f), 3.f));
+        TEST_ASSERT_OP(getInterpolated(0, 3, 0.5f), ==, 2);
+        TEST_ASSERT_OP(getInterpolated(0, -3, 0.5f), ==, -2);
+
+        const auto v(getInterpolated(Vec2i{0, 10}, Vec2i{5, 0}, 0.3f));
+        TEST_ASSERT_OP(v.x, ==, 2);
+        TEST_ASSERT_OP(v.y, ==, 7);
+
+        // Decreasing unsigned values do not wrap around.
+        TEST_ASSERT_OP(getInterpolated(10u, 4u, 0.5f), ==, 7u);
+        TEST_ASSERT_OP(
+            getInterpolated(Vec2u{10, 10}, Vec2u{4, 4}, 0.5f).x, ==, 7u);
+
+        const auto f(getInterpolated(Vec2f{0.f, 10.f}, Vec2f{5.f, 0.f}, 0.3f));
+        TEST_ASSERT(near(f.x, 1.5f));
+        TEST_ASSERT(near(f.y, 7.f));
+
+        // Angles take the shortest arc, across the wrap-around.
+        TEST_ASSERT(near(getInterpolatedDeg(350.f, 10.f, 0.5f), 360.f));
+        TEST_ASSERT(near(getInterpolatedDeg(10.f, 350.f, 0.5f), 0.f));
+    }
+
+    {
+        Interpolated<float> x{1.f};
+        TEST_ASSERT(near(x.get(0.5f), 1.f));
+
+        x.push(3.f);
+        TEST_ASSERT(near(x.get(0.f), 1.f));
+        TEST_ASSERT(near(x.get(0.5f), 2.f));
+        TEST_ASSERT(near(x.get(1.f), 3.f));
+
+        x.snap(8.f);
+        TEST_ASSERT(near(x.get(0.5f), 8.f));
+    }
+
+    {
+        sf::Transformable t;
+        InterpolatedTransform it{t};
+
+        t.setPosition(10.f, 20.f);
+        it.push(t);
+
+        const auto p(it.getTransform(0.5f).transformPoint(0.f, 0.f));
+        TEST_ASSERT(near(p.x, 5.f));
+        TEST_ASSERT(near(p.y, 10.f));
+    }
+
+    {
+        GameHeadless headless;
+        GameState state;
+        float alpha{-1.f};
+
+        state.onDrawInterpolated += [&alpha](float mX) { alpha = mX; };
+
+        headless.setGameState(state);
+        headless.setTimer<TimerStatic>(1.f, 2.f);
+        headless.setDrawEnabled(true);
+
+        // 3 of time: one tick of 2, leaving half a slice.
+        headless.setFrameTime(3.f);
+        headless.step();
+        TEST_ASSERT(near(alpha, 0.5f));
+
+        // 6 in total: three ticks, nothing left.
+        headless.step();
+        TEST_ASSERT(near(alpha, 0.f));
+        TEST_ASSERT_OP(headless.getTicks(), ==, 3u);
+
+        headless.setTimer<TimerDynamic>();
+        headless.step();
+        TEST_ASSERT(near(alpha, 1.f));
+    }
+
+    return 0;
+}
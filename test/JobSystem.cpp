@@ -0,0 +1,74 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <atomic>
+#include <vector>
+
+int main()
+{
+    using namespace ssvs;
+
+    {
+        JobSystem jobs{3};
+        std::vector<int> values(10000, 1);
+
+        jobs.parallelFor(0, values.size(), [&values](std::size_t i) {
+            values[i] *= 2;
+        });
+
+        int sum{0};
+        for(const auto v : values) sum += v;
+        TEST_ASSERT_OP(sum, ==, 20000);
+    }
+
+    {
+        JobSystem jobs{3};
+        TaskGraph graph;
+        std::atomic<int> step{0};
+        int a{-1}, b{-1}, c{-1}, d{-1};
+
+        const auto ta(graph.add([&] { a = step++; }));
+        const auto tb(graph.add([&] { b = step++; }, {ta}));
+        const auto tc(graph.add([&] { c = step++; }, {ta}));
+        graph.add([&] { d = step++; }, {tb, tc});
+
+        for(auto i(0); i < 10; ++i)
+        {
+            step = 0;
+            graph.run(jobs);
+
+            TEST_ASSERT_OP(a, ==, 0);
+            TEST_ASSERT_OP(b, >, a);
+            TEST_ASSERT_OP(c, >, a);
+            TEST_ASSERT_OP(d, ==, 3);
+        }
+    }
+
+    {
+        GameHeadless headless;
+        GameState state;
+        std::atomic<int> done{0};
+        int expected{0};
+        bool joined{true};
+
+        state.onUpdate += [&](FT) {
+            joined = joined && done == expected;
+
+            for(auto i(0); i < 8; ++i) headless.runAsync([&done] { ++done; });
+            expected += 8;
+        };
+        state.onPostUpdate += [&] { joined = joined && done == expected; };
+
+        headless.setGameState(state);
+        headless.setTimer<TimerStatic>(1.f, 1.f);
+        headless.setFrameTime(4.f);
+        headless.run(50);
+
+        TEST_ASSERT(joined);
+        TEST_ASSERT_OP(done.load(), ==, 50 * 4 * 8);
+    }
+}
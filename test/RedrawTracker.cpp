@@ -0,0 +1,75 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <cstddef>
+
+int main()
+{
+    using namespace ssvs;
+
+    GameHeadless headless;
+    GameState state;
+    std::size_t draws{0};
+
+    state.onDraw += [&draws] { ++draws; };
+
+    headless.setGameState(state);
+    headless.setTimer<TimerStatic>(1.f, 1.f);
+    headless.setDrawEnabled(true);
+    headless.setRetainedMode(true);
+    TEST_ASSERT(headless.isRetainedMode());
+    TEST_ASSERT(headless.isInvalidated());
+
+    // The first frame is always drawn, even without an update tick.
+    headless.step(0.f);
+    TEST_ASSERT_OP(draws, ==, 1u);
+    TEST_ASSERT(!headless.isInvalidated());
+
+    // Frames without ticks, events or invalidation are skipped.
+    headless.step(0.f);
+    headless.step(0.f);
+    headless.step(0.f);
+    TEST_ASSERT_OP(draws, ==, 1u);
+    TEST_ASSERT_OP(headless.getSkippedFrames(), ==, 3u);
+
+    // An update tick redraws.
+    headless.step(1.f);
+    TEST_ASSERT_OP(draws, ==, 2u);
+
+    headless.invalidate();
+    TEST_ASSERT(headless.isInvalidated());
+    headless.step(0.f);
+    TEST_ASSERT_OP(draws, ==, 3u);
+    TEST_ASSERT(!headless.isInvalidated());
+
+    // So does any event.
+    sf::Event e;
+    e.type = sf::Event::MouseMoved;
+    e.mouseMove = {4, 2};
+    headless.pushEvent(e);
+    headless.step(0.f);
+    TEST_ASSERT_OP(draws, ==, 4u);
+
+    headless.step(0.f);
+    TEST_ASSERT_OP(draws, ==, 4u);
+    TEST_ASSERT_OP(headless.getSkippedFrames(), ==, 4u);
+
+    // Without retained mode, every frame is drawn.
+    headless.setRetainedMode(false);
+    headless.step(0.f);
+    headless.step(0.f);
+    TEST_ASSERT_OP(draws, ==, 6u);
+    TEST_ASSERT_OP(headless.getSkippedFrames(), ==, 4u);
+
+    // Frames that are not drawn anyway are not counted as skipped.
+    headless.setRetainedMode(true);
+    headless.setDrawEnabled(false);
+    headless.step(0.f);
+    headless.step(0.f);
+    TEST_ASSERT_OP(draws, ==, 6u);
+    TEST_ASSERT_OP(headless.getSkippedFrames(), ==, 4u);
+}
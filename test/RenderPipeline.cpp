@@ -0,0 +1,187 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/GameSystem/DrawList.hpp>
+#include <SSVStart/GameSystem/RenderPipeline.hpp>
+#include <SSVStart/BitmapText/BitmapText.hpp>
+
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+    // Render target that logs draws instead of issuing GL calls.
+    struct LogTarget : sf::RenderTarget
+    {
+        // Id of every drawn `LogDrawable` and the view center it saw.
+        std::vector<std::pair<int, float>> log;
+        std::size_t displayed{0};
+
+        sf::Vector2u getSize() const override
+        {
+            return {640, 480};
+        }
+
+        bool setActive(bool = true) override
+        {
+            return true;
+        }
+
+        void display()
+        {
+            ++displayed;
+        }
+    };
+
+    struct LogDrawable : sf::Drawable
+    {
+        int id;
+
+        LogDrawable(int mId) : id{mId}
+        {
+        }
+
+    protected:
+        void draw(sf::RenderTarget& mTarget, sf::RenderStates) const override
+        {
+            static_cast<LogTarget&>(mTarget).log.emplace_back(
+                id, mTarget.getView().getCenter().x);
+        }
+    };
+
+    struct NonCopyable : sf::Drawable
+    {
+        NonCopyable() = default;
+        NonCopyable(const NonCopyable&) = delete;
+
+    protected:
+        void draw(sf::RenderTarget&, sf::RenderStates) const override
+        {
+        }
+    };
+
+    struct Flattened
+    {
+        sf::Vertex quad[4];
+
+        template <typename TList>
+        void recordTo(TList& mList, sf::RenderStates mStates) const
+        {
+            mList.add(quad, 4, sf::PrimitiveType::Quads, mStates);
+        }
+    };
+
+    sf::View getView(float mCenterX)
+    {
+        return {{mCenterX, 0.f}, {640.f, 480.f}};
+    }
+} // namespace
+
+int main()
+{
+    using namespace ssvs;
+
+    static_assert(isDrawListRecordable<sf::Sprite>);
+    static_assert(isDrawListRecordable<LogDrawable>);
+    static_assert(isDrawListRecordable<Flattened>);
+    static_assert(isDrawListRecordable<BitmapText>);
+    static_assert(isDrawListRecordable<BitmapTextRich>);
+    static_assert(!isDrawListRecordable<NonCopyable>);
+    static_assert(!isDrawListRecordable<sf::Drawable>);
+    static_assert(!isDrawListRecordable<sf::Text>);
+
+    {
+        DrawList list;
+        LogTarget target;
+
+        list.setView(getView(1.f));
+        list.add(LogDrawable{0});
+        list.setView(getView(2.f));
+        list.add(LogDrawable{1});
+        list.add(Flattened{});
+
+        TEST_ASSERT_OP(list.getCommandCount(), ==, 5u);
+        TEST_ASSERT_OP(list.getVertexCount(), ==, 4u);
+
+        list.submit(target);
+        TEST_ASSERT_OP(target.log.size(), ==, 2u);
+        TEST_ASSERT_OP(target.log[0].second, ==, 1.f);
+        TEST_ASSERT_OP(target.log[1].second, ==, 2.f);
+        TEST_ASSERT_OP(target.getView().getCenter().x, ==, 2.f);
+
+        // Clearing discards the draws, not the view they would have used.
+        list.reset();
+        list.setView(getView(3.f));
+        list.add(LogDrawable{2});
+        list.clear();
+        TEST_ASSERT_OP(list.getCommandCount(), ==, 1u);
+        TEST_ASSERT_OP(list.getVertexCount(), ==, 0u);
+    }
+
+    // Callbacks are called by `submit`, in order with the other commands.
+    {
+        DrawList list;
+        LogTarget target;
+        const LogDrawable drawable{7};
+
+        list.add(LogDrawable{6});
+        list.addCallback([&drawable](sf::RenderTarget& mTarget,
+                             const sf::RenderStates& mStates) {
+            mTarget.draw(drawable, mStates);
+        });
+        TEST_ASSERT_OP(list.getCommandCount(), ==, 2u);
+
+        list.submit(target);
+        TEST_ASSERT_OP(target.log.size(), ==, 2u);
+        TEST_ASSERT_OP(target.log[0].first, ==, 6);
+        TEST_ASSERT_OP(target.log[1].first, ==, 7);
+    }
+
+    {
+        LogTarget target;
+        BasicRenderPipeline<LogTarget> pipeline{target};
+        std::atomic<int> mismatches{0};
+        constexpr int frameCount{500};
+
+        pipeline.start();
+
+        for(int i{0}; i < frameCount; ++i)
+        {
+            auto& list(pipeline.getRecordList());
+            TEST_ASSERT(list.isEmpty());
+
+            list.setView(getView(float(i)));
+            list.add(LogDrawable{i});
+
+            // Tasks must see the frame they were posted in, with its view.
+            pipeline.post([i, &mismatches](LogTarget& mTarget) {
+                if(mTarget.log.back().first != i ||
+                    mTarget.getView().getCenter().x != float(i))
+                    ++mismatches;
+            });
+
+            pipeline.present();
+        }
+
+        pipeline.stop();
+        TEST_ASSERT(!pipeline.isRunning());
+
+        TEST_ASSERT_OP(mismatches.load(), ==, 0);
+        TEST_ASSERT_OP(target.displayed, ==, std::size_t(frameCount));
+        TEST_ASSERT_OP(target.log.size(), ==, std::size_t(frameCount));
+
+        for(int i{0}; i < frameCount; ++i)
+        {
+            TEST_ASSERT_OP(target.log[i].first, ==, i);
+            TEST_ASSERT_OP(target.log[i].second, ==, float(i));
+        }
+    }
+
+    return 0;
+}
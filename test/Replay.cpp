@@ -0,0 +1,71 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <sstream>
+
+int main()
+{
+    using namespace ssvs;
+
+    std::stringstream log;
+
+    {
+        ReplayRecorder recorder{log};
+        Input::InputState inputState;
+
+        for(auto i(0u); i < 10; ++i)
+        {
+            inputState[KKey::A] = i >= 2 && i < 5;
+
+            if(i == 2)
+            {
+                sf::Event e;
+                e.type = sf::Event::KeyPressed;
+                e.key.code = KKey::A;
+                recorder.recordEvent(e);
+            }
+
+            recorder.endFrame(FT(i % 3 + 1), inputState);
+        }
+
+        TEST_ASSERT_OP(recorder.getFrames(), ==, 10u);
+    }
+
+    {
+        GameHeadless headless;
+        GameState state;
+        std::size_t presses{0}, keyEvents{0};
+        FT simulated{0};
+
+        state.onUpdate += [&simulated](FT mFT) { simulated += mFT; };
+        state.onEvent(sf::Event::KeyPressed) +=
+            [&keyEvents](const sf::Event& mEvent) {
+                if(mEvent.key.code == KKey::A) ++keyEvents;
+            };
+        state.addInput(
+            {{KKey::A}}, [&presses](FT) { ++presses; }, Input::Type::Once);
+
+        headless.setGameState(state);
+        headless.setTimer<TimerDynamic>();
+
+        ReplayPlayer player{log};
+        TEST_ASSERT(player.isValid());
+
+        const auto stats(headless.replay(player));
+        TEST_ASSERT_OP(stats.frames, ==, 10u);
+        TEST_ASSERT_OP(simulated, ==, 19.f);
+        TEST_ASSERT_OP(keyEvents, ==, 1u);
+        TEST_ASSERT_OP(presses, ==, 1u);
+        TEST_ASSERT(player.isValid());
+    }
+
+    {
+        std::stringstream garbage{"not a replay"};
+        ReplayPlayer player{garbage};
+        TEST_ASSERT(!player.isValid());
+    }
+}
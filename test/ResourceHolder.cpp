@@ -0,0 +1,82 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    std::size_t allocationCount{0};
+}
+
+void* operator new(std::size_t mSize)
+{
+    ++allocationCount;
+    if(void* p = std::malloc(mSize == 0 ? 1 : mSize)) return p;
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* mPtr) noexcept
+{
+    std::free(mPtr);
+}
+
+void operator delete(void* mPtr, std::size_t) noexcept
+{
+    std::free(mPtr);
+}
+
+int main()
+{
+    using namespace ssvs;
+
+    // Ids longer than the small string buffer, so that building a
+    // `std::string` from them would allocate.
+    const std::string id{"Sprites/Characters/Player/walk_cycle_sheet.png"};
+    const std::string path{"Sprites/Characters/Player/walk_cycle_sheet.png;"};
+
+    {
+        Impl::ResourceHolder<Tileset, RHPolicyDefault> holder;
+        auto& tileset(holder.load(id, Tileset{Vec2u{16, 16}}));
+        const auto& cHolder(holder);
+
+        // Slices of a longer string and literals are looked up as is.
+        const std::string_view slice{path.data(), id.size()};
+
+        const auto before(allocationCount);
+        TEST_ASSERT(holder.has(slice));
+        TEST_ASSERT(&holder[slice] == &tileset);
+        TEST_ASSERT(&cHolder[slice] == &tileset);
+        TEST_ASSERT(
+            &holder["Sprites/Characters/Player/walk_cycle_sheet.png"] ==
+            &tileset);
+        TEST_ASSERT(!holder.has("Sprites/Characters/Player/run_cycle.png"));
+        TEST_ASSERT_OP(allocationCount, ==, before);
+    }
+
+    {
+        AssetManager<> mgr;
+        const auto& cMgr(mgr);
+
+        // Missing ids resolve to the null asset without being mapped.
+        const auto before(allocationCount);
+        TEST_ASSERT(&mgr.get<sf::Image>(id) == &getDefaultAsset<sf::Image>());
+        TEST_ASSERT(
+            &cMgr.get<sf::Image>(id) == &getDefaultAsset<sf::Image>());
+        TEST_ASSERT(!cMgr.has<sf::Image>(id));
+        TEST_ASSERT(cMgr.getAll<sf::Image>().empty());
+        TEST_ASSERT_OP(allocationCount, ==, before);
+
+        // Resolving a handle maps them, so that a later load fills it.
+        const auto handle(mgr.getHandle<sf::Image>(std::string_view{id}));
+        TEST_ASSERT(handle.isValid());
+        TEST_ASSERT(mgr.has<sf::Image>(id));
+    }
+}
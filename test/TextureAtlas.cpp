@@ -0,0 +1,92 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+    bool overlap(const sf::IntRect& mA, const sf::IntRect& mB)
+    {
+        return mA.left < mB.left + mB.width && mB.left < mA.left + mA.width &&
+               mA.top < mB.top + mB.height && mB.top < mA.top + mA.height;
+    }
+}
+
+int main()
+{
+    using namespace ssvs;
+
+    // Packed rectangles stay in bounds and never overlap.
+    {
+        Impl::SkylinePacker packer{{128, 128}};
+        std::vector<sf::IntRect> placed;
+
+        for(unsigned int i{0}; i < 200; ++i)
+        {
+            const unsigned int w{4 + (i * 7) % 13}, h{4 + (i * 5) % 11};
+            const auto p(packer.insert(w, h));
+            if(!p) continue;
+
+            TEST_ASSERT_OP(p->x + w, <=, 128u);
+            TEST_ASSERT_OP(p->y + h, <=, 128u);
+
+            const sf::IntRect r{int(p->x), int(p->y), int(w), int(h)};
+            for(const auto& o : placed) TEST_ASSERT(!overlap(r, o));
+            placed.emplace_back(r);
+        }
+
+        TEST_ASSERT_OP(placed.size(), >, 100u);
+        TEST_ASSERT(!packer.insert(129, 1));
+    }
+
+    // Images of a manager are found under their ids after building.
+    {
+        AssetManager<> mgr;
+
+        for(unsigned int i{0}; i < 40; ++i)
+        {
+            auto image(std::make_unique<sf::Image>());
+            image->create(8 + i % 24, 8 + (i * 3) % 24);
+            mgr.adopt<sf::Image>("img" + std::to_string(i), std::move(image));
+        }
+
+        auto huge(std::make_unique<sf::Image>());
+        huge->create(512, 16);
+        mgr.adopt<sf::Image>("huge", std::move(huge));
+
+        // Mapped to the null image, which is not packed.
+        (void)mgr.getHandle<sf::Image>("missing");
+
+        TextureAtlas atlas{{128, 128}};
+        TEST_ASSERT_OP(atlas.addFromManager(mgr), ==, 40u);
+        TEST_ASSERT(atlas.build());
+
+        TEST_ASSERT_OP(atlas.getPageCount(), >, 1u);
+        TEST_ASSERT(!atlas.has("huge"));
+        TEST_ASSERT(!atlas.has("missing"));
+        TEST_ASSERT(atlas.find("missing") == nullptr);
+
+        for(unsigned int i{0}; i < 40; ++i)
+        {
+            const auto id("img" + std::to_string(i));
+            const auto& r(atlas[id]);
+            const auto& size(mgr.get<sf::Image>(id).getSize());
+
+            TEST_ASSERT(r.texture != nullptr);
+            TEST_ASSERT_OP(r.rect.width, ==, int(size.x));
+            TEST_ASSERT_OP(r.rect.height, ==, int(size.y));
+
+            for(unsigned int j{0}; j < i; ++j)
+            {
+                const auto& o(atlas["img" + std::to_string(j)]);
+                if(o.texture == r.texture)
+                    TEST_ASSERT(!overlap(r.rect, o.rect));
+            }
+        }
+    }
+}
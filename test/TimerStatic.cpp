@@ -0,0 +1,83 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <chrono>
+#include <thread>
+
+int main()
+{
+    using namespace ssvs;
+
+    {
+        // Without a frame budget, the fixed limit applies and the backlog
+        // is kept.
+        GameHeadless headless;
+        GameState state;
+
+        headless.setGameState(state);
+        headless.setTimer<TimerStatic>(1.f, 1.f, 5.f);
+        headless.setFrameTime(10.f);
+
+        // The timer is installed at the start of the next frame.
+        headless.step(0.f);
+        auto& timer(headless.getTimer<TimerStatic>());
+
+        headless.step();
+        TEST_ASSERT_OP(timer.getLoops(), ==, 5.f);
+        TEST_ASSERT_OP(timer.getTime(), ==, 5.f);
+        TEST_ASSERT_OP(timer.getDroppedTime(), ==, 0.f);
+
+        headless.step();
+        TEST_ASSERT_OP(timer.getTime(), ==, 10.f);
+    }
+
+    {
+        // Ticks costing at least 3ms with a 4ms budget: after the first
+        // frame, a single tick runs per frame and the rest is dropped.
+        GameHeadless headless;
+        GameState state;
+
+        state.onUpdate += [](FT) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{3});
+        };
+
+        headless.setGameState(state);
+        headless.setTimer<TimerStatic>(1.f, 1.f);
+        headless.setFrameTime(10.5f);
+
+        headless.step(0.f);
+        auto& timer(headless.getTimer<TimerStatic>());
+        timer.setFrameBudget(4.f);
+
+        headless.step();
+        TEST_ASSERT_OP(timer.getLoops(), ==, 10.f);
+        TEST_ASSERT_OP(timer.getTickCost(), >=, 3.f);
+        TEST_ASSERT_OP(timer.getAdaptiveMaxLoops(), ==, 1.f);
+
+        headless.step();
+        TEST_ASSERT_OP(timer.getLoops(), ==, 1.f);
+        TEST_ASSERT_OP(timer.getLastDroppedTime(), ==, 10.f);
+        TEST_ASSERT_OP(timer.getTime(), ==, 0.f);
+
+        headless.step();
+        TEST_ASSERT_OP(timer.getLoops(), ==, 1.f);
+        TEST_ASSERT_OP(timer.getDroppedTime(), ==, 19.f);
+        TEST_ASSERT_OP(timer.getInterpolation(), ==, 0.5f);
+        TEST_ASSERT_OP(headless.getTicks(), ==, 12u);
+
+        // Resetting forgets the measured cost and the adapted limit.
+        timer.reset();
+        TEST_ASSERT_OP(timer.getTickCost(), ==, 0.f);
+        TEST_ASSERT_OP(timer.getAdaptiveMaxLoops(), ==, 50.f);
+        TEST_ASSERT_OP(timer.getTime(), ==, 0.f);
+
+        headless.step();
+        TEST_ASSERT_OP(timer.getLoops(), ==, 10.f);
+    }
+
+    return 0;
+}
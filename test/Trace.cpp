@@ -0,0 +1,75 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include "./utils/test_utils.hpp"
+#include <SSVStart/SSVStart.hpp>
+
+#include <sstream>
+#include <string>
+#include <thread>
+
+int main()
+{
+    using namespace ssvs;
+
+    auto& tracer(Trace::Tracer::get());
+
+    {
+        SSVS_PROFILE_SCOPE("not recorded");
+    }
+    TEST_ASSERT_OP(tracer.getEventCount(), ==, 0u);
+
+    tracer.start();
+
+    {
+        SSVS_PROFILE_SCOPE("outer");
+        SSVS_PROFILE_SCOPE("inner \"quoted\"");
+    }
+
+    std::thread t{[] { SSVS_PROFILE_SCOPE("worker"); }};
+    t.join();
+
+    {
+        GameHeadless headless;
+        GameState state;
+
+        headless.setGameState(state);
+        headless.setTimer<TimerDynamic>();
+        headless.run(3);
+    }
+
+    tracer.stop();
+    TEST_ASSERT_OP(tracer.getEventCount(), ==, 9u);
+
+    std::ostringstream out;
+    tracer.writeChromeTrace(out);
+    const auto json(out.str());
+
+    TEST_ASSERT(json.find("\"traceEvents\"") != std::string::npos);
+    TEST_ASSERT(json.find("\"name\":\"outer\"") != std::string::npos);
+    TEST_ASSERT(json.find("inner \\\"quoted\\\"") != std::string::npos);
+    TEST_ASSERT(json.find("\"tid\":1") != std::string::npos);
+    TEST_ASSERT(json.find("GameEngine::runUpdate") != std::string::npos);
+
+    tracer.clear();
+    TEST_ASSERT_OP(tracer.getEventCount(), ==, 0u);
+
+    // Events recorded outside of scopes are published in batches, and when
+    // their thread exits. The limit applies as they are published.
+    tracer.setMaxEventsPerThread(10);
+    tracer.start();
+
+    std::thread t2{[&tracer] {
+        for(auto i(0); i < 3000; ++i)
+            tracer.record("batched", tracer.now(), tracer.now());
+    }};
+    t2.join();
+
+    tracer.stop();
+    TEST_ASSERT_OP(tracer.getEventCount(), ==, 10u);
+    TEST_ASSERT_OP(tracer.getDroppedCount(), ==, 2990u);
+
+    tracer.clear();
+    TEST_ASSERT_OP(tracer.getDroppedCount(), ==, 0u);
+}
@@ -0,0 +1,33 @@
+// Copyright (c) 2013-2015 Vittorio Romeo
+// License: Academic Free License ("AFL") v. 3.0
+// AFL License page: http://opensource.org/licenses/AFL-3.0
+
+#include <SSVStart/Assets/AssetArchive.hpp>
+
+#include <iostream>
+
+// Usage: ssvs_pack_assets <asset folder root> <output archive>
+//
+// The root is used as given to `ssvs::AssetFolder`, e.g. `Assets/`, so that
+// ids in the archive match the ones the folder would produce.
+
+int main(int argc, char** argv)
+{
+    if(argc != 3)
+    {
+        std::cerr << "Usage: " << argv[0] << " <root> <output>\n";
+        return 1;
+    }
+
+    ssvs::AssetArchiveWriter writer;
+    writer.addFolder(argv[1]);
+
+    if(!writer.write(argv[2]))
+    {
+        std::cerr << "Failed to write " << argv[2] << '\n';
+        return 1;
+    }
+
+    std::cout << "Packed " << writer.getCount() << " files into " << argv[2]
+              << '\n';
+}